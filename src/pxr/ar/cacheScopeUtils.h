@@ -0,0 +1,20 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#ifndef PXR_AR_CACHE_SCOPE_UTILS_H
+#define PXR_AR_CACHE_SCOPE_UTILS_H
+
+/// \file ar/cacheScopeUtils.h
+///
+/// Internal cache scope utilities. This header is not installed.
+
+namespace pxr {
+
+/// Returns true if a cache scope is open in the calling thread.
+bool Ar_IsCacheScopeActive();
+
+}  // namespace pxr
+
+#endif // PXR_AR_CACHE_SCOPE_UTILS_H
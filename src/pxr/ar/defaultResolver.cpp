@@ -8,29 +8,51 @@
 #include "./defaultResolver.h"
 
 #include "./assetInfo.h"
+#include "./defaultResolverCache.h"
 #include "./defaultResolverContext.h"
 #include "./defineResolver.h"
 #include "./filesystemAsset.h"
 #include "./filesystemWritableAsset.h"
 #include "./notice.h"
 #include "./resolverContext.h"
+#include "./seekableCompressedAsset.h"
 #include "./writableAsset.h"
 
 #include <pxr/arch/fileSystem.h>
 #include <pxr/arch/systemInfo.h>
+#include <pxr/tf/envSetting.h>
 #include <pxr/tf/errorMark.h>
 #include <pxr/tf/fileUtils.h>
 #include <pxr/tf/getenv.h>
+#include <pxr/tf/hash.h>
 #include <pxr/tf/pathUtils.h>
 #include <pxr/tf/safeOutputFile.h>
 #include <pxr/tf/staticData.h>
 #include <pxr/tf/stringUtils.h>
 #include <pxr/vt/value.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 namespace pxr {
 
 AR_DEFINE_RESOLVER(ArDefaultResolver, ArResolver);
 
+TF_DEFINE_ENV_SETTING(
+    PXR_AR_DEFAULT_RESOLVER_CACHE, false,
+    "Cache the results of resolving search paths in ArDefaultResolver "
+    "until the context is refreshed or the default search path changes.");
+
+TF_DEFINE_ENV_SETTING(
+    PXR_AR_DEFAULT_RESOLVER_CACHE_SIZE, 65536,
+    "Maximum number of results cached for each search path when "
+    "PXR_AR_DEFAULT_RESOLVER_CACHE is enabled.");
+
 static bool
 _IsFileRelative(const std::string& path) {
     return path.find("./") == 0 || path.find("../") == 0;
@@ -85,22 +107,173 @@ struct _ArDefaultResolverFallbackContext {
         }
     }
 
+    // Guards context. Readers only take this lock when version has changed
+    // since their last snapshot.
+    std::mutex mutex;
     ArDefaultResolverContext context;
+
+    // Incremented each time context is replaced.
+    std::atomic<uint64_t> version{1};
 };
 
 static TfStaticData<_ArDefaultResolverFallbackContext> _DefaultPath;
 
+struct _DefaultPathSnapshot {
+    uint64_t version = 0;
+    ArDefaultResolverContext context;
+};
+
+// Returns the calling thread's snapshot of the default search path,
+// refreshing it if the search path has changed since it was taken.
+//
+// Each thread keeps its own reference to the search path, so resolving
+// under load touches no shared state but the version counter. A replaced
+// search path is freed once every thread that used it has refreshed its
+// snapshot or exited. The returned reference is valid until the calling
+// thread calls this function again.
+static const _DefaultPathSnapshot&
+_GetDefaultPathSnapshot()
+{
+    static thread_local _DefaultPathSnapshot snapshot;
+
+    _ArDefaultResolverFallbackContext& fallback = *_DefaultPath;
+    if (fallback.version.load(std::memory_order_acquire) != snapshot.version) {
+        std::lock_guard<std::mutex> lock(fallback.mutex);
+        snapshot.context = fallback.context;
+        snapshot.version = fallback.version.load(std::memory_order_relaxed);
+    }
+    return snapshot;
+}
+
+// Cache of the results of resolving search paths under a single
+// ArDefaultResolverContext, shared by every thread that binds it.
+//
+// Entries are split across shards by path so that threads resolving
+// different paths rarely contend on the same lock. Each entry records the
+// refresh generation and default search path version it was computed with
+// and is recomputed if either has changed. Stale entries are only removed
+// when a shard fills up; if a shard is still full after that, it is
+// cleared, so the number of entries never exceeds the limit set by
+// PXR_AR_DEFAULT_RESOLVER_CACHE_SIZE.
+struct Ar_DefaultResolverCache {
+    struct _Entry {
+        uint64_t generation;
+        uint64_t defaultPathVersion;
+        ArResolvedPath resolvedPath;
+    };
+
+    struct alignas(64) _Shard {
+        std::mutex mutex;
+        std::unordered_map<std::string, _Entry> entries;
+    };
+
+    static constexpr size_t NumShards = 32;
+
+    _Shard& GetShard(const std::string& path)
+    {
+        return shards[TfHash()(path) % NumShards];
+    }
+
+    // Stores \p entry for \p path in \p shard, whose mutex must be held.
+    static void Store(
+        _Shard& shard, const std::string& path, _Entry&& entry)
+    {
+        static const size_t maxEntries = std::max<size_t>(1,
+            std::max(TfGetEnvSetting(PXR_AR_DEFAULT_RESOLVER_CACHE_SIZE), 0)
+                / NumShards);
+
+        const auto existing = shard.entries.find(path);
+        if (existing != shard.entries.end()) {
+            existing->second = std::move(entry);
+            return;
+        }
+
+        if (shard.entries.size() >= maxEntries) {
+            for (auto it = shard.entries.begin();
+                 it != shard.entries.end(); ) {
+                if (it->second.generation != entry.generation ||
+                    it->second.defaultPathVersion != 
+                        entry.defaultPathVersion) {
+                    it = shard.entries.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            if (shard.entries.size() >= maxEntries) {
+                shard.entries.clear();
+            }
+        }
+
+        shard.entries.emplace(path, std::move(entry));
+    }
+
+    // Incremented by RefreshContext.
+    std::atomic<uint64_t> generation{0};
+    _Shard shards[NumShards];
+};
+
+void
+Ar_DestroyDefaultResolverCache(Ar_DefaultResolverCache* cache)
+{
+    delete cache;
+}
+
+static bool
+_IsResolveCacheEnabled()
+{
+    static const bool enabled = TfGetEnvSetting(PXR_AR_DEFAULT_RESOLVER_CACHE);
+    return enabled;
+}
+
+ArDefaultResolver::~ArDefaultResolver()
+{
+    delete _unboundResolveCache.load();
+}
+
+Ar_DefaultResolverCache*
+ArDefaultResolver::_GetResolveCache(
+    const ArDefaultResolverContext* ctx, bool create) const
+{
+    if (!_IsResolveCacheEnabled()) {
+        return nullptr;
+    }
+
+    std::atomic<Ar_DefaultResolverCache*>& slot = ctx && ctx->_data ?
+        ctx->_data->resolveCache : _unboundResolveCache;
+
+    Ar_DefaultResolverCache* cache = slot.load(std::memory_order_acquire);
+    if (cache || !create) {
+        return cache;
+    }
+
+    // Contexts that are never bound while resolving, like the default
+    // search path, never allocate a cache.
+    std::unique_ptr<Ar_DefaultResolverCache> newCache(
+        new Ar_DefaultResolverCache);
+    if (slot.compare_exchange_strong(
+            cache, newCache.get(), std::memory_order_acq_rel)) {
+        return newCache.release();
+    }
+    return cache;
+}
+
 void
 ArDefaultResolver::SetDefaultSearchPath(
     const std::vector<std::string>& searchPath)
 {
     ArDefaultResolverContext newFallback = ArDefaultResolverContext(searchPath);
 
-    if (newFallback == _DefaultPath->context) {
-        return;
-    }
+    {
+        _ArDefaultResolverFallbackContext& fallback = *_DefaultPath;
+        std::lock_guard<std::mutex> lock(fallback.mutex);
+        if (newFallback == fallback.context) {
+            return;
+        }
 
-    _DefaultPath->context = std::move(newFallback);
+        std::swap(fallback.context, newFallback);
+        fallback.version.fetch_add(1, std::memory_order_release);
+    }
 
     ArNotice::ResolverChanged([](const ArResolverContext& ctx){
         return ctx.Get<ArDefaultResolverContext>() != nullptr;
@@ -202,24 +375,76 @@ ArDefaultResolver::_Resolve(const std::string& path) const
         // If that fails and the path is a search path, try to resolve
         // against each directory in the specified search paths.
         if (_IsSearchPath(path)) {
-            const ArDefaultResolverContext* contexts[2] =
-                {_GetCurrentContextPtr(), &_DefaultPath->context};
-            for (const ArDefaultResolverContext* ctx : contexts) {
-                if (ctx) {
-                    for (const auto& searchPath : ctx->GetSearchPath()) {
-                        resolvedPath = _ResolveAnchored(searchPath, path);
-                        if (resolvedPath) {
-                            return resolvedPath;
-                        }
+            return _ResolveSearchPath(path);
+        }
+
+        return ArResolvedPath();
+    }
+
+    return _ResolveAnchored(std::string(), path);
+}
+
+ArResolvedPath
+ArDefaultResolver::_ResolveSearchPath(const std::string& path) const
+{
+    const ArDefaultResolverContext* currentContext = _GetCurrentContextPtr();
+    const _DefaultPathSnapshot& defaultPath = _GetDefaultPathSnapshot();
+
+    auto resolve = [&]() {
+        const ArDefaultResolverContext* contexts[2] =
+            {currentContext, &defaultPath.context};
+        for (const ArDefaultResolverContext* ctx : contexts) {
+            if (ctx) {
+                for (const auto& searchPath : ctx->GetSearchPath()) {
+                    ArResolvedPath resolvedPath =
+                        _ResolveAnchored(searchPath, path);
+                    if (resolvedPath) {
+                        return resolvedPath;
                     }
                 }
             }
         }
-
         return ArResolvedPath();
+    };
+
+    Ar_DefaultResolverCache* cache =
+        _GetResolveCache(currentContext, /* create = */ true);
+    if (!cache) {
+        return resolve();
     }
 
-    return _ResolveAnchored(std::string(), path);
+    using _Entry = Ar_DefaultResolverCache::_Entry;
+    const uint64_t generation =
+        cache->generation.load(std::memory_order_acquire);
+    Ar_DefaultResolverCache::_Shard& shard = cache->GetShard(path);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const auto it = shard.entries.find(path);
+        if (it != shard.entries.end()) {
+            const _Entry& entry = it->second;
+            if (entry.generation == generation &&
+                entry.defaultPathVersion == defaultPath.version) {
+                return entry.resolvedPath;
+            }
+        }
+    }
+
+    // Paths that fail to resolve are cached too, since those require
+    // searching every directory.
+    ArResolvedPath resolvedPath = resolve();
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        Ar_DefaultResolverCache::Store(
+            shard, path, _Entry{generation, defaultPath.version, resolvedPath});
+    }
+    return resolvedPath;
+}
+
+ArResolvedPath
+Ar_ResolveWithDefaultResolver(
+    const ArDefaultResolver& resolver, const std::string& assetPath)
+{
+    return resolver.ArDefaultResolver::_Resolve(assetPath);
 }
 
 ArResolvedPath
@@ -241,7 +466,12 @@ std::shared_ptr<ArAsset>
 ArDefaultResolver::_OpenAsset(
     const ArResolvedPath& resolvedPath) const
 {
-    return ArFilesystemAsset::Open(resolvedPath);
+    std::shared_ptr<ArAsset> asset = ArFilesystemAsset::Open(resolvedPath);
+    if (asset && ArSeekableCompressedAsset::IsEnabledForExtension(
+            TfGetExtension(resolvedPath))) {
+        return ArSeekableCompressedAsset::Open(asset);
+    }
+    return asset;
 }
 
 std::shared_ptr<ArWritableAsset>
@@ -252,6 +482,43 @@ ArDefaultResolver::_OpenAssetForWrite(
     return ArFilesystemWritableAsset::Create(resolvedPath, writeMode);
 }
 
+bool
+ArDefaultResolver::_CopyAsset(
+    const ArResolvedPath& srcResolvedPath,
+    const ArResolvedPath& dstResolvedPath,
+    WriteMode writeMode) const
+{
+    const std::shared_ptr<ArFilesystemAsset> srcAsset =
+        ArFilesystemAsset::Open(srcResolvedPath);
+    if (!srcAsset) {
+        TF_RUNTIME_ERROR(
+            "Could not open asset '%s' for copy",
+            srcResolvedPath.GetPathString().c_str());
+        return false;
+    }
+
+    const std::shared_ptr<ArFilesystemWritableAsset> dstAsset =
+        ArFilesystemWritableAsset::Create(dstResolvedPath, writeMode);
+    if (!dstAsset) {
+        TF_RUNTIME_ERROR(
+            "Could not open asset '%s' for write",
+            dstResolvedPath.GetPathString().c_str());
+        return false;
+    }
+
+    const size_t assetSize = srcAsset->GetSize();
+    if (dstAsset->WriteFromFile(
+            srcAsset->GetFileUnsafe().first, 0, assetSize, 0) != assetSize) {
+        TF_RUNTIME_ERROR(
+            "Failed to copy asset '%s' to '%s'",
+            srcResolvedPath.GetPathString().c_str(),
+            dstResolvedPath.GetPathString().c_str());
+        return false;
+    }
+
+    return dstAsset->Close();
+}
+
 bool
 ArDefaultResolver::_IsContextDependentPath(
     const std::string& assetPath) const
@@ -259,6 +526,35 @@ ArDefaultResolver::_IsContextDependentPath(
     return _IsSearchPath(assetPath);
 }
 
+void
+ArDefaultResolver::_RefreshContext(const ArResolverContext& context)
+{
+    const ArDefaultResolverContext* ctx =
+        context.Get<ArDefaultResolverContext>();
+    if (!_IsResolveCacheEnabled()) {
+        return;
+    }
+
+    // Nothing has been cached for contexts that haven't been used to
+    // resolve a path yet.
+    if (Ar_DefaultResolverCache* cache =
+            _GetResolveCache(ctx, /* create = */ false)) {
+        cache->generation.fetch_add(1, std::memory_order_release);
+    }
+
+    // Assets found in the search path may now resolve differently.
+    if (ctx && !ctx->GetSearchPath().empty()) {
+        ArNotice::ResolverChanged(*ctx).Send();
+    }
+    else {
+        ArNotice::ResolverChanged([](const ArResolverContext& ctx) {
+            const ArDefaultResolverContext* defaultCtx =
+                ctx.Get<ArDefaultResolverContext>();
+            return !defaultCtx || defaultCtx->GetSearchPath().empty();
+        }).Send();
+    }
+}
+
 ArResolverContext 
 ArDefaultResolver::_CreateDefaultContext() const
 {
@@ -269,7 +565,35 @@ ArResolverContext
 ArDefaultResolver::_CreateContextFromString(
     const std::string& contextStr) const
 {
-    return ArDefaultResolverContext(_ParseSearchPaths(contextStr));
+    {
+        std::lock_guard<std::mutex> lock(_contextsFromStringMutex);
+        auto it = _contextsFromString.find(contextStr);
+        if (it != _contextsFromString.end()) {
+            return it->second;
+        }
+    }
+
+    const std::vector<std::string> searchPath = _ParseSearchPaths(contextStr);
+    ArResolverContext context{ArDefaultResolverContext(searchPath)};
+
+    // Relative search paths are anchored to the current working directory,
+    // which may change between calls, so only contexts made entirely of
+    // absolute paths are remembered.
+    const bool isCacheable = std::none_of(
+        searchPath.begin(), searchPath.end(), _IsRelativePath);
+    if (isCacheable) {
+        // Bound the cache in case of clients that create contexts from
+        // many distinct strings.
+        static const size_t maxCachedContexts = 1024;
+
+        std::lock_guard<std::mutex> lock(_contextsFromStringMutex);
+        if (_contextsFromString.size() >= maxCachedContexts) {
+            _contextsFromString.clear();
+        }
+        _contextsFromString.emplace(contextStr, context);
+    }
+
+    return context;
 }
 
 ArResolverContext 
@@ -280,8 +604,13 @@ ArDefaultResolver::_CreateDefaultContextForAsset(
         return ArResolverContext(ArDefaultResolverContext());
     }
 
+    // Strip the trailing separator from the directory so the context
+    // doesn't need to normalize it again.
     std::string assetDir = TfGetPathName(TfAbsPath(assetPath));
-    
+    if (assetDir.size() > 1 && assetDir.back() == '/') {
+        assetDir.pop_back();
+    }
+
     return ArResolverContext(ArDefaultResolverContext(
                                  std::vector<std::string>(1, assetDir)));
 }
@@ -15,12 +15,17 @@
 #include "./resolvedPath.h"
 #include "./resolver.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace pxr {
 
+struct Ar_DefaultResolverCache;
+
 /// \class ArDefaultResolver
 ///
 /// Default asset resolution implementation used when no plugin
@@ -47,6 +52,16 @@ namespace pxr {
 /// ArDefaultResolver supports creating an ArDefaultResolverContext via
 /// ArResolver::CreateContextFromString by passing a list of directories
 /// delimited by the platform's standard path separator.
+///
+/// If the environment setting PXR_AR_DEFAULT_RESOLVER_CACHE is enabled,
+/// the results of resolving asset paths against the search path are cached
+/// for each ArDefaultResolverContext and shared by all threads binding that
+/// context. Assets added to or removed from the search path directories
+/// are not seen until ArResolver::RefreshContext is called with the context
+/// or the default search path changes. Refreshing an empty context
+/// refreshes the results for when no search path is bound. The number of
+/// results cached for each search path is limited by the environment
+/// setting PXR_AR_DEFAULT_RESOLVER_CACHE_SIZE.
 class ArDefaultResolver
     : public ArResolver
 {
@@ -55,7 +70,7 @@ public:
     ArDefaultResolver() = default;
 
     AR_API 
-    virtual ~ArDefaultResolver() = default;
+    virtual ~ArDefaultResolver();
 
     /// Set the default search path that will be used during asset
     /// resolution. Calling this function will trigger a ResolverChanged
@@ -66,8 +81,9 @@ public:
     /// variable PXR_AR_DEFAULT_SEARCH_PATH. Calling this function will
     /// override any path specified in this manner.
     ///
-    /// This function is not thread-safe and should not be called concurrently
-    /// with any other ArResolver operations
+    /// This function may be called concurrently with asset resolution in
+    /// other threads. Each thread sees the new search path the next time it
+    /// resolves an asset.
     AR_API
     static void SetDefaultSearchPath(
         const std::vector<std::string>& searchPath);
@@ -112,6 +128,11 @@ protected:
     ArResolverContext _CreateContextFromString(
         const std::string& contextStr) const override;
 
+    /// Discards the cached search path results for \p context and sends an
+    /// ArNotice::ResolverChanged notice if resolve caching is enabled.
+    AR_API
+    void _RefreshContext(const ArResolverContext& context) override;
+
     AR_API
     bool _IsContextDependentPath(
         const std::string& assetPath) const override;
@@ -132,10 +153,45 @@ protected:
         const ArResolvedPath& resolvedPath,
         WriteMode writeMode) const override;
 
+    /// Copies the file at \p srcResolvedPath to \p dstResolvedPath using
+    /// an ArFilesystemWritableAsset, so the destination is updated with the
+    /// same atomicity guarantees as _OpenAssetForWrite. The copy is
+    /// performed by the kernel where possible.
+    AR_API
+    bool _CopyAsset(
+        const ArResolvedPath& srcResolvedPath,
+        const ArResolvedPath& dstResolvedPath,
+        WriteMode writeMode) const override;
+
 private:
+    // Calls ArDefaultResolver::_Resolve on \p resolver without going
+    // through ArResolver::Resolve's virtual call. ArGetResolver() uses this
+    // when an ArDefaultResolver is the primary resolver.
+    friend ArResolvedPath Ar_ResolveWithDefaultResolver(
+        const ArDefaultResolver& resolver, const std::string& assetPath);
+
     const ArDefaultResolverContext* _GetCurrentContextPtr() const;
 
+    // Resolves \p path against the bound and default search paths.
+    ArResolvedPath _ResolveSearchPath(const std::string& path) const;
+
+    // Returns the resolve cache for \p ctx, creating it if \p create is
+    // true and it does not exist yet. Returns null if caching is disabled.
+    Ar_DefaultResolverCache* _GetResolveCache(
+        const ArDefaultResolverContext* ctx, bool create) const;
+
     ArResolverContext _defaultContext;
+
+    // Resolve cache used when no search path is bound, created on first
+    // use.
+    mutable std::atomic<Ar_DefaultResolverCache*> _unboundResolveCache{
+        nullptr};
+
+    // Contexts previously created by _CreateContextFromString, keyed by
+    // context string.
+    mutable std::mutex _contextsFromStringMutex;
+    mutable std::unordered_map<std::string, ArResolverContext>
+        _contextsFromString;
 };
 
 }  // namespace pxr
@@ -0,0 +1,24 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#ifndef PXR_AR_DEFAULT_RESOLVER_CACHE_H
+#define PXR_AR_DEFAULT_RESOLVER_CACHE_H
+
+/// \file ar/defaultResolverCache.h
+///
+/// Internal ArDefaultResolver resolve cache utilities. This header is not
+/// installed.
+
+namespace pxr {
+
+struct Ar_DefaultResolverCache;
+
+/// Destroys \p cache, which may be null. Used by ArDefaultResolverContext,
+/// which cannot see the definition of Ar_DefaultResolverCache.
+void Ar_DestroyDefaultResolverCache(Ar_DefaultResolverCache* cache);
+
+}  // namespace pxr
+
+#endif // PXR_AR_DEFAULT_RESOLVER_CACHE_H
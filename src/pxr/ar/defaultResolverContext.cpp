@@ -6,25 +6,83 @@
 // Modified by Jeremy Retailleau.
 
 #include "./defaultResolverContext.h"
+#include "./defaultResolverCache.h"
+#include "./internTable.h"
 
+#include <pxr/arch/defines.h>
 #include <pxr/tf/diagnostic.h>
 #include <pxr/tf/hash.h>
 #include <pxr/tf/ostreamMethods.h>
 #include <pxr/tf/pathUtils.h>
 #include <pxr/tf/stringUtils.h>
 
+#include <algorithm>
+#include <memory>
+#include <utility>
+
 namespace pxr {
 
+namespace
+{
+
+// Returns true if \p path is an absolute path that TfAbsPath would return
+// unchanged, i.e. it has no empty, "." or ".." components and no trailing
+// separator.
+bool
+_IsNormalizedAbsolutePath(const std::string& path)
+{
+#if defined(ARCH_OS_WINDOWS)
+    // Drive letters and separators are normalized by TfAbsPath on Windows,
+    // so always defer to it.
+    return false;
+#else
+    if (path.empty() || path[0] != '/') {
+        return false;
+    }
+    if (path.size() == 1) {
+        return true;
+    }
+
+    size_t start = 1;
+    while (true) {
+        const size_t end = std::min(path.find('/', start), path.size());
+        const size_t length = end - start;
+        if (length == 0 ||
+            (length == 1 && path[start] == '.') ||
+            (length == 2 && path[start] == '.' && path[start + 1] == '.')) {
+            return false;
+        }
+        if (end == path.size()) {
+            return true;
+        }
+        start = end + 1;
+    }
+#endif
+}
+
+} // end anonymous namespace
+
+ArDefaultResolverContext::_Data::~_Data()
+{
+    Ar_DestroyDefaultResolverCache(resolveCache.load());
+}
+
 ArDefaultResolverContext::ArDefaultResolverContext(
     const std::vector<std::string>& searchPath)
 {
-    _searchPath.reserve(searchPath.size());
+    std::vector<std::string> normalizedPath;
+    normalizedPath.reserve(searchPath.size());
     for (const std::string& p : searchPath) {
         if (p.empty()) {
             continue;
         }
 
-        const std::string absPath = TfAbsPath(p);
+        if (_IsNormalizedAbsolutePath(p)) {
+            normalizedPath.push_back(p);
+            continue;
+        }
+
+        std::string absPath = TfAbsPath(p);
         if (absPath.empty()) {
             TF_WARN(
                 "Could not determine absolute path for search path prefix "
@@ -32,20 +90,46 @@ ArDefaultResolverContext::ArDefaultResolverContext(
             continue;
         }
 
-        _searchPath.push_back(absPath);
+        normalizedPath.push_back(std::move(absPath));
+    }
+
+    if (normalizedPath.empty()) {
+        return;
     }
+
+    // Search paths are shared by all contexts with the same search path.
+    const size_t hash = TfHash()(normalizedPath);
+    _data = Ar_InternTable<_Data>::GetInstance().Intern(
+        hash,
+        [&normalizedPath](const _Data& data) {
+            return data.searchPath == normalizedPath;
+        },
+        [&normalizedPath, hash]() {
+            std::unique_ptr<_Data> data(new _Data);
+            data->searchPath = std::move(normalizedPath);
+            data->hash = hash;
+            return data;
+        });
+}
+
+const std::vector<std::string>&
+ArDefaultResolverContext::_GetEmptySearchPath()
+{
+    static const std::vector<std::string> empty;
+    return empty;
 }
 
 bool
 ArDefaultResolverContext::operator<(const ArDefaultResolverContext& rhs) const
 {
-    return _searchPath < rhs._searchPath;
+    return _data != rhs._data && GetSearchPath() < rhs.GetSearchPath();
 }
 
 bool 
 ArDefaultResolverContext::operator==(const ArDefaultResolverContext& rhs) const
 {
-    return _searchPath == rhs._searchPath;
+    // Search paths are interned, so equal search paths share storage.
+    return _data == rhs._data;
 }
 
 bool 
@@ -58,21 +142,15 @@ std::string
 ArDefaultResolverContext::GetAsString() const
 {
     std::string result = "Search path: ";
-    if (_searchPath.empty()) {
+    if (!_data) {
         result += "[ ]";
     }
     else {
         result += "[\n    ";
-        result += TfStringJoin(_searchPath, "\n    ");
+        result += TfStringJoin(_data->searchPath, "\n    ");
         result += "\n]";
     }
     return result;
 }
 
-size_t 
-hash_value(const ArDefaultResolverContext& context)
-{
-    return TfHash()(context.GetSearchPath());
-}
-
 }  // namespace pxr
@@ -13,11 +13,15 @@
 #include "./api.h"
 #include "./defineResolverContext.h"
 
+#include <atomic>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace pxr {
 
+struct Ar_DefaultResolverCache;
+
 /// \class ArDefaultResolverContext
 ///
 /// Resolver context object that specifies a search path to use during
@@ -43,6 +47,9 @@ namespace pxr {
 /// // resolution.
 /// \endcode
 ///
+/// Search paths are immutable and shared between all contexts with the
+/// same search path, so copying, comparing and hashing contexts is cheap.
+///
 class ArDefaultResolverContext
 {
 public:
@@ -51,7 +58,8 @@ public:
 
     /// Construct a context with the given \p searchPath.
     /// Elements in \p searchPath should be absolute paths. If they are not,
-    /// they will be anchored to the current working directory.
+    /// they will be anchored to the current working directory. Elements
+    /// that are already absolute and normalized are used as-is.
     AR_API ArDefaultResolverContext(const std::vector<std::string>& searchPath);
 
     AR_API bool operator<(const ArDefaultResolverContext& rhs) const;
@@ -61,18 +69,39 @@ public:
     /// Return this context's search path.
     const std::vector<std::string>& GetSearchPath() const
     {
-        return _searchPath;
+        return _data ? _data->searchPath : _GetEmptySearchPath();
     }
 
     /// Return a string representation of this context for debugging.
     AR_API std::string GetAsString() const;
 
+    friend size_t hash_value(const ArDefaultResolverContext& context)
+    {
+        return context._data ? context._data->hash : 0;
+    }
+
 private:
-    std::vector<std::string> _searchPath;
-};
+    friend class ArDefaultResolver;
 
-AR_API size_t 
-hash_value(const ArDefaultResolverContext& context);
+    struct _Data
+    {
+        ~_Data();
+
+        std::vector<std::string> searchPath;
+        size_t hash;
+
+        // Cache of resolved paths for this search path, created by
+        // ArDefaultResolver the first time a path is resolved with this
+        // search path bound. Null until then or if resolve caching is
+        // disabled.
+        mutable std::atomic<Ar_DefaultResolverCache*> resolveCache{nullptr};
+    };
+
+    AR_API static const std::vector<std::string>& _GetEmptySearchPath();
+
+    // Shared storage for the search path, or null if it is empty.
+    std::shared_ptr<const _Data> _data;
+};
 
 inline std::string 
 ArGetDebugString(const ArDefaultResolverContext& context)
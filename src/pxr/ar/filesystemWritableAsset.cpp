@@ -7,6 +7,7 @@
 
 #include "./filesystemWritableAsset.h"
 
+#include <pxr/arch/defines.h>
 #include <pxr/arch/errno.h>
 #include <pxr/arch/fileSystem.h>
 #include <pxr/tf/diagnostic.h>
@@ -14,33 +15,143 @@
 #include <pxr/tf/fileUtils.h>
 #include <pxr/tf/safeOutputFile.h>
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#if defined(ARCH_OS_LINUX) || defined(ARCH_OS_DARWIN)
+#include <fcntl.h>
+#endif
+
+#if defined(ARCH_OS_LINUX)
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <climits>
+#endif
+
 namespace pxr {
 
-std::shared_ptr<ArFilesystemWritableAsset>
-ArFilesystemWritableAsset::Create(
-    const ArResolvedPath& resolvedPath,
-    ArResolver::WriteMode writeMode)
+namespace {
+
+// Cache of directories known to exist, so that writing many assets into
+// the same few directories does not stat each directory for every asset.
+// Entries are added once a directory has been found or created, and are
+// dropped if opening a file in that directory fails, since the directory
+// may have been removed since it was cached.
+class _ExistingDirCache
+{
+public:
+    bool Contains(const std::string& dir) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _dirs.count(dir) != 0;
+    }
+
+    void Insert(const std::string& dir)
+    {
+        // Bound the cache in case of long-running processes that write
+        // into many distinct directories.
+        static const size_t maxCachedDirs = 4096;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_dirs.size() >= maxCachedDirs) {
+            _dirs.clear();
+        }
+        _dirs.insert(dir);
+    }
+
+    void Erase(const std::string& dir)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _dirs.erase(dir);
+    }
+
+private:
+    mutable std::mutex _mutex;
+    std::unordered_set<std::string> _dirs;
+};
+
+_ExistingDirCache&
+_GetExistingDirCache()
+{
+    static _ExistingDirCache cache;
+    return cache;
+}
+
+bool
+_MakeDirs(const std::string& dir, const ArResolvedPath& resolvedPath)
 {
-    const std::string dir = TfGetPathName(resolvedPath);
     // Call TfMakedirs with existOk = true so we don't fail if the directory is
     // created by another thread or process at the same time.
-    if (!dir.empty() && !TfIsDir(dir) && !TfMakeDirs(dir, -1, true)) {
+    if (!TfIsDir(dir) && !TfMakeDirs(dir, -1, true)) {
         TF_RUNTIME_ERROR(
             "Could not create directory '%s' for asset '%s'", 
             dir.c_str(), resolvedPath.GetPathString().c_str());
-        return nullptr;
+        return false;
     }
 
-    TfErrorMark m;
+    _GetExistingDirCache().Insert(dir);
+    return true;
+}
 
-    TfSafeOutputFile f;
+TfSafeOutputFile
+_OpenFile(
+    const ArResolvedPath& resolvedPath,
+    ArResolver::WriteMode writeMode)
+{
     switch (writeMode) {
     case ArResolver::WriteMode::Update:
-        f = TfSafeOutputFile::Update(resolvedPath);
-        break;
+        return TfSafeOutputFile::Update(resolvedPath);
     case ArResolver::WriteMode::Replace:
-        f = TfSafeOutputFile::Replace(resolvedPath);
-        break;
+        return TfSafeOutputFile::Replace(resolvedPath);
+    }
+    return TfSafeOutputFile();
+}
+
+} // end anonymous namespace
+
+std::shared_ptr<ArFilesystemWritableAsset>
+ArFilesystemWritableAsset::Create(
+    const ArResolvedPath& resolvedPath,
+    ArResolver::WriteMode writeMode)
+{
+    const std::string dir = TfGetPathName(resolvedPath);
+
+    const bool dirWasCached =
+        !dir.empty() && _GetExistingDirCache().Contains(dir);
+
+    if (!dir.empty() && !dirWasCached && !_MakeDirs(dir, resolvedPath)) {
+        return nullptr;
+    }
+
+    TfErrorMark m;
+
+    TfSafeOutputFile f = _OpenFile(resolvedPath, writeMode);
+
+    if (!m.IsClean() && !dir.empty()) {
+        // The cached directory may have been removed. Drop it from the
+        // cache and, if we skipped checking for it, try again after
+        // making sure it exists.
+        _GetExistingDirCache().Erase(dir);
+
+        if (dirWasCached) {
+            m.Clear();
+            if (!_MakeDirs(dir, resolvedPath)) {
+                return nullptr;
+            }
+            f = _OpenFile(resolvedPath, writeMode);
+            if (!m.IsClean()) {
+                _GetExistingDirCache().Erase(dir);
+            }
+        }
     }
 
     if (!m.IsClean()) {
@@ -81,4 +192,198 @@ ArFilesystemWritableAsset::Write(
     return numWritten;
 }
 
+#if defined(ARCH_OS_LINUX)
+// Writes all the buffers in \p iov to \p fd at \p offset, continuing after
+// partial writes. Returns the number of bytes written.
+static size_t
+_PWriteV(int fd, std::vector<iovec>& iov, size_t offset)
+{
+    size_t numWritten = 0;
+    size_t index = 0;
+    while (index < iov.size()) {
+        const int numBuffers =
+            static_cast<int>(std::min<size_t>(iov.size() - index, IOV_MAX));
+        const ssize_t n =
+            pwritev(fd, &iov[index], numBuffers, offset + numWritten);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            TF_RUNTIME_ERROR(
+                "Error occurred writing file: %s", ArchStrerror().c_str());
+            break;
+        }
+        numWritten += n;
+
+        // Skip past the buffers that were fully written and adjust the
+        // first buffer that was only partially written, if any.
+        size_t remaining = n;
+        while (index < iov.size() && remaining >= iov[index].iov_len) {
+            remaining -= iov[index].iov_len;
+            ++index;
+        }
+        if (remaining > 0) {
+            iov[index].iov_base =
+                static_cast<char*>(iov[index].iov_base) + remaining;
+            iov[index].iov_len -= remaining;
+        }
+    }
+    return numWritten;
+}
+#endif
+
+size_t
+ArFilesystemWritableAsset::WriteRanges(
+    const WriteRequest* requests, size_t numRequests)
+{
+#if defined(ARCH_OS_LINUX)
+    const int fd = ArchFileNo(_file.Get());
+
+    std::vector<iovec> iov;
+    size_t numWritten = 0;
+    size_t i = 0;
+    while (i < numRequests) {
+        // Gather the run of requests starting at i whose ranges follow each
+        // other so they can be written with a single call.
+        const size_t runOffset = requests[i].offset;
+        size_t runSize = 0;
+        iov.clear();
+        for (; i < numRequests; ++i) {
+            const WriteRequest& request = requests[i];
+            if (request.offset != runOffset + runSize) {
+                break;
+            }
+            if (request.count > 0) {
+                iov.push_back(
+                    { const_cast<void*>(request.buffer), request.count });
+                runSize += request.count;
+            }
+        }
+
+        if (runSize == 0) {
+            continue;
+        }
+
+        const size_t n = _PWriteV(fd, iov, runOffset);
+        numWritten += n;
+        if (n != runSize) {
+            break;
+        }
+    }
+    return numWritten;
+#else
+    return ArWritableAsset::WriteRanges(requests, numRequests);
+#endif
+}
+
+bool
+ArFilesystemWritableAsset::Reserve(size_t totalSize)
+{
+    if (totalSize == 0) {
+        return true;
+    }
+
+#if defined(ARCH_OS_LINUX)
+    // FALLOC_FL_KEEP_SIZE allocates blocks without changing the file size,
+    // so readers never see reserved space that was not actually written.
+    return fallocate(
+        ArchFileNo(_file.Get()), FALLOC_FL_KEEP_SIZE, 0, totalSize) == 0;
+#elif defined(ARCH_OS_DARWIN)
+    // F_PREALLOCATE allocates relative to the physical end of the file, so
+    // only request the space that is not already allocated.
+    const int64_t fileSize = ArchGetFileLength(_file.Get());
+    if (fileSize < 0 || static_cast<size_t>(fileSize) >= totalSize) {
+        return fileSize >= 0;
+    }
+
+    const int fd = ArchFileNo(_file.Get());
+    fstore_t store = {
+        F_ALLOCATECONTIG, F_PEOFPOSMODE, 0,
+        static_cast<off_t>(totalSize - fileSize), 0 };
+    if (fcntl(fd, F_PREALLOCATE, &store) == -1) {
+        // Contiguous allocation may fail on fragmented volumes; fall back
+        // to allocating non-contiguous blocks.
+        store.fst_flags = F_ALLOCATEALL;
+        return fcntl(fd, F_PREALLOCATE, &store) != -1;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t
+ArFilesystemWritableAsset::WriteFromFile(
+    FILE* srcFile, size_t srcOffset, size_t count, size_t offset)
+{
+    if (!srcFile) {
+        TF_CODING_ERROR("Invalid source file");
+        return 0;
+    }
+
+    size_t numCopied = 0;
+
+#if defined(ARCH_OS_LINUX)
+    const int srcFd = ArchFileNo(srcFile);
+    const int dstFd = ArchFileNo(_file.Get());
+
+#if defined(FICLONE)
+    // If the entire source file is being copied into an empty file, try
+    // to share the source file's extents via a reflink. This only succeeds
+    // on filesystems with copy-on-write support like Btrfs or XFS.
+    if (srcOffset == 0 && offset == 0 &&
+        ArchGetFileLength(_file.Get()) == 0 &&
+        ArchGetFileLength(srcFile) == static_cast<int64_t>(count) &&
+        ioctl(dstFd, FICLONE, srcFd) == 0) {
+        return count;
+    }
+#endif
+
+#if defined(__GLIBC__) && \
+    (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+    // Let the kernel transfer the data directly between the files. This
+    // may fail if the kernel or filesystems involved don't support it, in
+    // which case we fall back to copying the data ourselves below.
+    loff_t srcPos = srcOffset, dstPos = offset;
+    while (numCopied < count) {
+        const ssize_t n = copy_file_range(
+            srcFd, &srcPos, dstFd, &dstPos, count - numCopied, 0);
+        if (n <= 0) {
+            break;
+        }
+        numCopied += n;
+    }
+#endif
+#endif
+
+    if (numCopied == count) {
+        return count;
+    }
+
+    constexpr size_t maxChunkSize = 1024 * 1024;
+    const size_t chunkSize = std::min(count - numCopied, maxChunkSize);
+    std::unique_ptr<char[]> chunk(new char[chunkSize]);
+
+    while (numCopied < count) {
+        const size_t chunkCount = std::min(chunkSize, count - numCopied);
+        const int64_t numRead = ArchPRead(
+            srcFile, chunk.get(), chunkCount, srcOffset + numCopied);
+        if (numRead <= 0) {
+            TF_RUNTIME_ERROR(
+                "Error occurred reading file: %s",
+                numRead == 0 ? "Unexpected end of file" :
+                ArchStrerror().c_str());
+            return 0;
+        }
+
+        if (Write(chunk.get(), numRead, offset + numCopied) !=
+            static_cast<size_t>(numRead)) {
+            return 0;
+        }
+        numCopied += numRead;
+    }
+
+    return numCopied;
+}
+
 }  // namespace pxr
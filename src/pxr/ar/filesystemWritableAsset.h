@@ -56,10 +56,39 @@ public:
     /// Writes \p count bytes from \p buffer at \p offset from the beginning
     /// of the file held by this object. Returns number of bytes written, or
     /// 0 on error.
+    ///
+    /// This uses positional writes that do not modify the file position,
+    /// so it may be called concurrently to write disjoint ranges.
     AR_API
     virtual size_t Write(
         const void* buffer, size_t count, size_t offset) override;
 
+    /// Performs the \p numRequests writes in \p requests in order.
+    /// Runs of requests whose ranges are adjacent are combined and written
+    /// with a single vectored write (pwritev) where the platform supports
+    /// it, so gathered output can be written without a staging copy.
+    AR_API
+    virtual size_t WriteRanges(
+        const WriteRequest* requests, size_t numRequests) override;
+
+    /// Preallocates storage for \p totalSize bytes in the file held by this
+    /// object without changing its size. Returns false if the platform or
+    /// filesystem does not support preallocation.
+    AR_API
+    virtual bool Reserve(size_t totalSize) override;
+
+    /// Writes \p count bytes read from \p srcFile at \p srcOffset to
+    /// \p offset from the beginning of the file held by this object.
+    /// Returns number of bytes written, or 0 on error.
+    ///
+    /// Where the platform supports it, the data is transferred by the
+    /// kernel without being copied through user space, using reflinks
+    /// (FICLONE) when copying an entire file into an empty file and
+    /// copy_file_range otherwise.
+    AR_API
+    size_t WriteFromFile(
+        FILE* srcFile, size_t srcOffset, size_t count, size_t offset);
+
 private:
     TfSafeOutputFile _file;
 };
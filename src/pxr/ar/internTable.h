@@ -0,0 +1,104 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#ifndef PXR_AR_INTERN_TABLE_H
+#define PXR_AR_INTERN_TABLE_H
+
+/// \file ar/internTable.h
+///
+/// Internal helper for sharing storage between equal objects. This header
+/// is not installed.
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace pxr {
+
+/// \class Ar_InternTable
+///
+/// Table of interned, immutable objects of type \p T keyed by hash. The
+/// table only holds weak references, so an object is removed from the
+/// table once the last reference to it is released.
+///
+/// This class is thread-safe.
+template <class T>
+class Ar_InternTable
+{
+public:
+    /// Returns the table for objects of type \p T. The table is
+    /// intentionally leaked so that objects released during static
+    /// destruction can still remove themselves from it.
+    static Ar_InternTable& GetInstance()
+    {
+        static Ar_InternTable* table = new Ar_InternTable;
+        return *table;
+    }
+
+    /// Returns the object in the table with the given \p hash for which
+    /// \p equals returns true. If there is no such object, the object
+    /// returned by \p create, which must return a std::unique_ptr<T>, is
+    /// added to the table and returned.
+    template <class Equals, class Create>
+    std::shared_ptr<const T> Intern(
+        size_t hash, const Equals& equals, const Create& create)
+    {
+        // Objects found in the table that aren't equal to the requested
+        // object. These must be released after the table's lock, since
+        // releasing the last reference to an object removes it from the
+        // table.
+        std::vector<std::shared_ptr<const T>> mismatched;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto range = _entries.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            std::shared_ptr<const T> object = it->second.second.lock();
+            if (!object) {
+                continue;
+            }
+            if (equals(*object)) {
+                return object;
+            }
+            mismatched.push_back(std::move(object));
+        }
+
+        std::shared_ptr<const T> object(
+            create().release(),
+            [this, hash](const T* object) {
+                _Remove(hash, object);
+                delete object;
+            });
+
+        _entries.emplace(hash, std::make_pair(
+            object.get(), std::weak_ptr<const T>(object)));
+        return object;
+    }
+
+private:
+    Ar_InternTable() = default;
+
+    void _Remove(size_t hash, const T* object)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto range = _entries.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second.first == object) {
+                _entries.erase(it);
+                break;
+            }
+        }
+    }
+
+    std::mutex _mutex;
+    std::unordered_multimap<
+        size_t, std::pair<const T*, std::weak_ptr<const T>>> _entries;
+};
+
+}  // namespace pxr
+
+#endif // PXR_AR_INTERN_TABLE_H
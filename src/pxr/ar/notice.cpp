@@ -10,8 +10,85 @@
 #include <pxr/tf/registryManager.h>
 #include <pxr/tf/type.h>
 
+#include <algorithm>
+
 namespace pxr {
 
+namespace
+{
+
+// Returns \p prefix with any trailing separator removed, unless it is the
+// root directory.
+std::string
+_StripTrailingSeparator(std::string prefix)
+{
+    while (prefix.size() > 1 && prefix.back() == '/') {
+        prefix.pop_back();
+    }
+    return prefix;
+}
+
+// Inserts \p path into the sorted vector \p paths if it isn't already
+// present.
+void
+_InsertSorted(std::vector<std::string>* paths, std::string&& path)
+{
+    auto it = std::lower_bound(paths->begin(), paths->end(), path);
+    if (it == paths->end() || *it != path) {
+        paths->insert(it, std::move(path));
+    }
+}
+
+// Returns true if \p path or any of its parent directories is in the
+// sorted vector \p paths.
+bool
+_ContainsPathOrAncestor(
+    const std::vector<std::string>& paths, const std::string& path)
+{
+    if (paths.empty()) {
+        return false;
+    }
+
+    std::string candidate = _StripTrailingSeparator(path);
+    while (true) {
+        if (std::binary_search(paths.begin(), paths.end(), candidate)) {
+            return true;
+        }
+
+        const size_t sep = candidate.rfind('/');
+        if (sep == std::string::npos || candidate.size() == 1) {
+            return false;
+        }
+        candidate.resize(sep == 0 ? 1 : sep);
+    }
+}
+
+// Returns true if any path in the sorted vector \p paths is \p prefix or
+// in the directory \p prefix.
+bool
+_ContainsPathUnder(
+    const std::vector<std::string>& paths, const std::string& prefix)
+{
+    if (paths.empty()) {
+        return false;
+    }
+
+    std::string dir = _StripTrailingSeparator(prefix);
+    if (std::binary_search(paths.begin(), paths.end(), dir)) {
+        return true;
+    }
+
+    // All paths in the directory start with its name and a separator, so
+    // they sort next to each other.
+    if (dir.empty() || dir.back() != '/') {
+        dir += '/';
+    }
+    auto it = std::lower_bound(paths.begin(), paths.end(), dir);
+    return it != paths.end() && it->compare(0, dir.size(), dir) == 0;
+}
+
+} // end anonymous namespace
+
 TF_REGISTRY_FUNCTION(pxr::TfType)
 {
     TfType::Define<
@@ -30,7 +107,7 @@ ArNotice::ResolverChanged::ResolverChanged()
 
 ArNotice::ResolverChanged::ResolverChanged(
     const std::function<bool(const ArResolverContext&)>& affectsFn)
-    : _affects(affectsFn)
+    : _affects{affectsFn}
 {
 }
 
@@ -39,7 +116,69 @@ ArNotice::ResolverChanged::~ResolverChanged() = default;
 bool 
 ArNotice::ResolverChanged::AffectsContext(const ArResolverContext& ctx) const
 {
-    return _affects(ctx);
+    return std::any_of(
+        _affects.begin(), _affects.end(),
+        [&ctx](const std::function<bool(const ArResolverContext&)>& affects) {
+            return affects(ctx);
+        });
+}
+
+void
+ArNotice::ResolverChanged::AddChangedAssetPath(const std::string& assetPath)
+{
+    _affectsAllAssetPaths = false;
+    _InsertSorted(&_changedAssetPaths, std::string(assetPath));
+}
+
+void
+ArNotice::ResolverChanged::AddChangedPrefix(const std::string& prefix)
+{
+    _affectsAllAssetPaths = false;
+    _InsertSorted(&_changedPrefixes, _StripTrailingSeparator(prefix));
+}
+
+void
+ArNotice::ResolverChanged::Merge(const ResolverChanged& notice)
+{
+    if (&notice == this) {
+        return;
+    }
+
+    _affects.insert(
+        _affects.end(), notice._affects.begin(), notice._affects.end());
+
+    if (_affectsAllAssetPaths || notice._affectsAllAssetPaths) {
+        _affectsAllAssetPaths = true;
+        _changedAssetPaths.clear();
+        _changedPrefixes.clear();
+        return;
+    }
+
+    for (const std::string& assetPath : notice._changedAssetPaths) {
+        _InsertSorted(&_changedAssetPaths, std::string(assetPath));
+    }
+    for (const std::string& prefix : notice._changedPrefixes) {
+        _InsertSorted(&_changedPrefixes, std::string(prefix));
+    }
+}
+
+bool
+ArNotice::ResolverChanged::AffectsAssetPath(
+    const std::string& assetPath) const
+{
+    return _affectsAllAssetPaths ||
+        std::binary_search(
+            _changedAssetPaths.begin(), _changedAssetPaths.end(), assetPath) ||
+        _ContainsPathOrAncestor(_changedPrefixes, assetPath);
+}
+
+bool
+ArNotice::ResolverChanged::AffectsPrefix(const std::string& prefix) const
+{
+    return _affectsAllAssetPaths ||
+        _ContainsPathUnder(_changedAssetPaths, prefix) ||
+        _ContainsPathUnder(_changedPrefixes, prefix) ||
+        _ContainsPathOrAncestor(_changedPrefixes, prefix);
 }
 
 }  // namespace pxr
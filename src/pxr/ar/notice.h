@@ -14,6 +14,8 @@
 #include <pxr/tf/notice.h>
 
 #include <functional>
+#include <string>
+#include <vector>
 
 namespace pxr {
 
@@ -44,6 +46,14 @@ public:
     /// \class ResolverChanged
     /// Notice sent when asset paths may resolve to a different path than
     /// before due to a change in the resolver.
+    ///
+    /// By default, this notice indicates that any asset path may be
+    /// affected. Senders that know which resolved paths changed may
+    /// restrict the notice to those paths with AddChangedAssetPath and
+    /// AddChangedPrefix, allowing listeners to use AffectsAssetPath and
+    /// AffectsPrefix to invalidate only the affected entries in their
+    /// caches. Several changes may be coalesced into one notice with
+    /// Merge.
     class ResolverChanged 
         : public ResolverNotice
     {
@@ -76,8 +86,8 @@ public:
             // the other c'tor. Both of those cause issues in MSVC 2015; the
             // first causes an unspecified type error and the second causes
             // odd linker errors.
-            : _affects(std::bind(&Ar_ContextIsHolding<ContextObj>, contextObj, 
-                    std::placeholders::_1))
+            : _affects{std::bind(&Ar_ContextIsHolding<ContextObj>, contextObj, 
+                    std::placeholders::_1)}
         {
         }
  
@@ -89,8 +99,70 @@ public:
         AR_API 
         bool AffectsContext(const ArResolverContext& ctx) const;
 
+        /// \name Changed Paths
+        /// @{
+
+        /// Restricts this notice to the given resolved \p assetPath, in
+        /// addition to any other paths or prefixes previously added.
+        AR_API
+        void AddChangedAssetPath(const std::string& assetPath);
+
+        /// Restricts this notice to resolved paths that are \p prefix or
+        /// are in the directory \p prefix, in addition to any other paths
+        /// or prefixes previously added.
+        AR_API
+        void AddChangedPrefix(const std::string& prefix);
+
+        /// Combines \p notice into this notice. The combined notice affects
+        /// every context and path that either notice affects.
+        AR_API
+        void Merge(const ResolverChanged& notice);
+
+        /// Returns true if this notice has not been restricted to specific
+        /// paths, meaning any asset path may be affected.
+        bool AffectsAllAssetPaths() const
+        {
+            return _affectsAllAssetPaths;
+        }
+
+        /// Returns the resolved paths this notice has been restricted to,
+        /// in sorted order.
+        const std::vector<std::string>& GetChangedAssetPaths() const
+        {
+            return _changedAssetPaths;
+        }
+
+        /// Returns the directory prefixes this notice has been restricted
+        /// to, in sorted order.
+        const std::vector<std::string>& GetChangedPrefixes() const
+        {
+            return _changedPrefixes;
+        }
+
+        /// Returns true if the asset at the resolved \p assetPath may be
+        /// affected by this resolver change.
+        ///
+        /// Paths are compared component-wise as given, without any
+        /// normalization.
+        AR_API
+        bool AffectsAssetPath(const std::string& assetPath) const;
+
+        /// Returns true if the asset at \p prefix or any asset in the
+        /// directory \p prefix may be affected by this resolver change.
+        AR_API
+        bool AffectsPrefix(const std::string& prefix) const;
+
+        /// @}
+
     private:
-        std::function<bool(const ArResolverContext&)> _affects;
+        // Predicates for the contexts affected by this notice. A context is
+        // affected if any predicate returns true; merged notices contribute
+        // their predicates here rather than wrapping this notice's.
+        std::vector<std::function<bool(const ArResolverContext&)>> _affects;
+
+        bool _affectsAllAssetPaths = true;
+        std::vector<std::string> _changedAssetPaths;
+        std::vector<std::string> _changedPrefixes;
     };
 
 };
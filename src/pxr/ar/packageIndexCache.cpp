@@ -0,0 +1,292 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include "./packageIndexCache.h"
+#include "./asset.h"
+
+#include <pxr/tf/envSetting.h>
+#include <pxr/tf/weakPtr.h>
+
+#include <algorithm>
+
+namespace pxr {
+
+TF_DEFINE_ENV_SETTING(
+    PXR_AR_PACKAGE_INDEX_CACHE_MB, 64,
+    "Memory budget in megabytes for package indexes cached by "
+    "ArPackageIndexCache.");
+
+TF_DEFINE_ENV_SETTING(
+    PXR_AR_PACKAGE_INDEX_CACHE_OPEN_PACKAGES, 64,
+    "Maximum number of package indexes cached by ArPackageIndexCache "
+    "that may keep their package open.");
+
+namespace
+{
+
+// Approximate per-member overhead of a node in the index's hash table,
+// in addition to the key and value themselves.
+constexpr size_t _MemberNodeOverhead = 4 * sizeof(void*);
+
+} // end anonymous namespace
+
+ArPackageIndexCache::Index::Index()
+    : _memoryUsage(sizeof(Index))
+{
+}
+
+ArPackageIndexCache::Index::~Index() = default;
+
+void
+ArPackageIndexCache::Index::AddMember(
+    const std::string& path, const Member& member)
+{
+    if (_members.emplace(path, member).second) {
+        _memoryUsage += sizeof(std::pair<const std::string, Member>) +
+            _MemberNodeOverhead + path.capacity();
+    }
+}
+
+void
+ArPackageIndexCache::Index::SetPackage(
+    const std::shared_ptr<ArAsset>& asset,
+    const std::shared_ptr<const char>& buffer)
+{
+    // Contents that aren't backed by a file were read into memory, so they
+    // count against the cache's memory budget along with the index.
+    const auto isInMemory = [](const std::shared_ptr<ArAsset>& asset) {
+        return asset && !asset->GetFileUnsafe().first;
+    };
+
+    if (isInMemory(_packageAsset)) {
+        _memoryUsage -= _packageAsset->GetSize();
+    }
+    if (isInMemory(asset)) {
+        _memoryUsage += asset->GetSize();
+    }
+
+    _packageAsset = asset;
+    _packageBuffer = buffer;
+}
+
+const ArPackageIndexCache::Member*
+ArPackageIndexCache::Index::FindMember(const std::string& path) const
+{
+    const auto it = _members.find(path);
+    return it != _members.end() ? &it->second : nullptr;
+}
+
+ArPackageIndexCache&
+ArPackageIndexCache::GetInstance()
+{
+    // Intentionally leaked so the cache remains valid for package
+    // resolvers used during static destruction.
+    static ArPackageIndexCache* cache = new ArPackageIndexCache;
+    return *cache;
+}
+
+ArPackageIndexCache::ArPackageIndexCache()
+    : _memoryUsage(0)
+    , _memoryBudget(
+        size_t(std::max(TfGetEnvSetting(PXR_AR_PACKAGE_INDEX_CACHE_MB), 0))
+        * 1024 * 1024)
+    , _numOpenPackages(0)
+    , _openPackageLimit(
+        size_t(std::max(
+            TfGetEnvSetting(PXR_AR_PACKAGE_INDEX_CACHE_OPEN_PACKAGES), 0)))
+{
+    TfNotice::Register(
+        TfCreateWeakPtr(this), &ArPackageIndexCache::_HandleResolverChanged);
+}
+
+ArPackageIndexCache::~ArPackageIndexCache() = default;
+
+ArPackageIndexCache::IndexConstPtr
+ArPackageIndexCache::Find(
+    const std::string& resolvedPackagePath,
+    const ArTimestamp& timestamp)
+{
+    // Destroy a stale index after releasing the lock, since it may close
+    // the package it holds.
+    _EntryList removed;
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const auto it = _entryMap.find(resolvedPackagePath);
+    if (it == _entryMap.end()) {
+        return nullptr;
+    }
+
+    const _EntryList::iterator entryIt = it->second;
+    if (!timestamp.IsValid() || entryIt->timestamp != timestamp) {
+        _RemoveEntry(entryIt, &removed);
+        return nullptr;
+    }
+
+    // Mark this entry as most recently used.
+    _entries.splice(_entries.begin(), _entries, entryIt);
+    return entryIt->index;
+}
+
+void
+ArPackageIndexCache::Insert(
+    const std::string& resolvedPackagePath,
+    const ArTimestamp& timestamp,
+    const IndexConstPtr& index)
+{
+    if (!index || !timestamp.IsValid()) {
+        return;
+    }
+
+    // Destroy replaced and evicted indexes after releasing the lock.
+    _EntryList removed;
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const auto it = _entryMap.find(resolvedPackagePath);
+    if (it != _entryMap.end()) {
+        _RemoveEntry(it->second, &removed);
+    }
+
+    _entries.push_front(_Entry{ resolvedPackagePath, timestamp, index });
+    _entryMap.emplace(resolvedPackagePath, _entries.begin());
+    _memoryUsage += index->GetMemoryUsage();
+    if (index->GetPackageAsset()) {
+        ++_numOpenPackages;
+    }
+
+    _EvictToBudget(&removed);
+}
+
+void
+ArPackageIndexCache::Remove(const std::string& resolvedPackagePath)
+{
+    // Destroy the index after releasing the lock.
+    _EntryList removed;
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const auto it = _entryMap.find(resolvedPackagePath);
+    if (it != _entryMap.end()) {
+        _RemoveEntry(it->second, &removed);
+    }
+}
+
+void
+ArPackageIndexCache::Clear()
+{
+    // Destroy the indexes after releasing the lock.
+    _EntryList entries;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        entries.swap(_entries);
+        _entryMap.clear();
+        _memoryUsage = 0;
+        _numOpenPackages = 0;
+    }
+}
+
+void
+ArPackageIndexCache::SetMemoryBudget(size_t numBytes)
+{
+    // Destroy evicted indexes after releasing the lock.
+    _EntryList removed;
+    std::lock_guard<std::mutex> lock(_mutex);
+    _memoryBudget = numBytes;
+    _EvictToBudget(&removed);
+}
+
+size_t
+ArPackageIndexCache::GetMemoryBudget() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _memoryBudget;
+}
+
+size_t
+ArPackageIndexCache::GetMemoryUsage() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _memoryUsage;
+}
+
+void
+ArPackageIndexCache::SetOpenPackageLimit(size_t numPackages)
+{
+    // Destroy evicted indexes after releasing the lock.
+    _EntryList removed;
+    std::lock_guard<std::mutex> lock(_mutex);
+    _openPackageLimit = numPackages;
+    _EvictToBudget(&removed);
+}
+
+size_t
+ArPackageIndexCache::GetOpenPackageLimit() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _openPackageLimit;
+}
+
+size_t
+ArPackageIndexCache::GetNumOpenPackages() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _numOpenPackages;
+}
+
+void
+ArPackageIndexCache::_HandleResolverChanged(
+    const ArNotice::ResolverChanged& notice)
+{
+    // Indexes are validated against their package's timestamp whenever
+    // they're looked up and don't depend on the bound context, so notices
+    // that aren't restricted to specific paths, like those sent when a
+    // context is refreshed, leave the cache alone.
+    if (notice.AffectsAllAssetPaths()) {
+        return;
+    }
+
+    // Destroy the affected indexes after releasing the lock.
+    _EntryList affected;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto it = _entries.begin(); it != _entries.end(); ) {
+            auto next = std::next(it);
+            if (notice.AffectsAssetPath(it->packagePath)) {
+                _RemoveEntry(it, &affected);
+            }
+            it = next;
+        }
+    }
+}
+
+void
+ArPackageIndexCache::_EvictToBudget(_EntryList* removed)
+{
+    while (_memoryUsage > _memoryBudget && !_entries.empty()) {
+        _RemoveEntry(std::prev(_entries.end()), removed);
+    }
+
+    // Only indexes holding an opened package count towards the open
+    // package limit, so skip over the others.
+    auto it = _entries.end();
+    while (_numOpenPackages > _openPackageLimit && it != _entries.begin()) {
+        --it;
+        if (it->index->GetPackageAsset()) {
+            _RemoveEntry(it++, removed);
+        }
+    }
+}
+
+void
+ArPackageIndexCache::_RemoveEntry(
+    _EntryList::iterator entryIt, _EntryList* removed)
+{
+    _memoryUsage -= entryIt->index->GetMemoryUsage();
+    if (entryIt->index->GetPackageAsset()) {
+        --_numOpenPackages;
+    }
+    _entryMap.erase(entryIt->packagePath);
+    removed->splice(removed->end(), _entries, entryIt);
+}
+
+}  // namespace pxr
@@ -0,0 +1,265 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#ifndef PXR_AR_PACKAGE_INDEX_CACHE_H
+#define PXR_AR_PACKAGE_INDEX_CACHE_H
+
+/// \file ar/packageIndexCache.h
+
+#include "./api.h"
+#include "./notice.h"
+#include "./timestamp.h"
+
+#include <pxr/tf/weakBase.h>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace pxr {
+
+class ArAsset;
+
+/// \class ArPackageIndexCache
+///
+/// Process-wide cache of package indexes for use by ArPackageResolver
+/// implementations.
+///
+/// Package resolvers typically need to read a package's table of contents
+/// before they can resolve or open any of the files inside it. Caching that
+/// table of contents in ArPackageResolver::BeginCacheScope only avoids
+/// reading it again within a single scope. This cache allows the parsed
+/// table of contents to be shared across cache scopes and between threads.
+///
+/// Indexes are keyed by the resolved path of their package along with the
+/// package's modification timestamp, so a package that has changed on disk
+/// is never served a stale index. The cache is bounded by a memory budget
+/// and evicts the least recently used indexes when that budget is
+/// exceeded. The budget defaults to the value of the
+/// PXR_AR_PACKAGE_INDEX_CACHE_MB environment setting.
+///
+/// An index may also hold on to the opened package it describes, so that
+/// package resolvers can open files in the package without opening the
+/// package again for as long as its index is cached. Packages read into
+/// memory count against the memory budget. Packages backed by files hold
+/// a file descriptor and usually a memory mapping instead, so the number
+/// of cached indexes holding an opened package is limited separately. The
+/// limit defaults to the value of the
+/// PXR_AR_PACKAGE_INDEX_CACHE_OPEN_PACKAGES environment setting.
+///
+/// When an ArNotice::ResolverChanged notice restricted to specific paths
+/// is sent, the indexes for packages at those paths are discarded.
+/// Notices that aren't restricted to specific paths, such as those sent
+/// when a context is refreshed, don't discard any indexes, since indexes
+/// don't depend on the bound context and are already checked against
+/// their package's timestamp. Use Remove or Clear to discard indexes
+/// explicitly.
+///
+/// This class is thread-safe.
+class ArPackageIndexCache
+    : public TfWeakBase
+{
+public:
+    /// Description of a single file in a package.
+    ///
+    /// The meaning of \p offset, \p compression and \p flags is determined
+    /// by the package format. For example, \p offset may be the offset of
+    /// the file's data or of a header preceding the file's data.
+    struct Member
+    {
+        /// Offset of this file in the package.
+        uint64_t offset = 0;
+
+        /// Size of this file's contents, after decompression.
+        uint64_t size = 0;
+
+        /// Number of bytes this file occupies in the package.
+        uint64_t compressedSize = 0;
+
+        /// Checksum of this file's contents, if available.
+        uint32_t checksum = 0;
+
+        /// Format-specific identifier for the compression method applied
+        /// to this file, where 0 indicates no compression.
+        uint16_t compression = 0;
+
+        /// Format-specific flags for this file.
+        uint16_t flags = 0;
+    };
+
+    /// Table of contents for a package, mapping the paths of files in the
+    /// package to their Member records.
+    class Index
+    {
+    public:
+        AR_API
+        Index();
+
+        AR_API
+        ~Index();
+
+        /// Adds a record for the file at \p path in the package. If a
+        /// record for \p path already exists, it is left unchanged.
+        AR_API
+        void AddMember(const std::string& path, const Member& member);
+
+        /// Returns the record for the file at \p path in the package, or
+        /// nullptr if there is no such file.
+        AR_API
+        const Member* FindMember(const std::string& path) const;
+
+        /// Returns the number of files in the package.
+        size_t GetNumMembers() const
+        {
+            return _members.size();
+        }
+
+        /// Stores \p asset, the opened package described by this index,
+        /// along with \p buffer holding the package's contents. Since
+        /// indexes are cached by their package's modification timestamp,
+        /// these are never used after the package has changed.
+        ///
+        /// If \p asset is not backed by a file, its size is included in
+        /// this index's memory usage. This must be called before the index
+        /// is inserted into the cache.
+        AR_API
+        void SetPackage(
+            const std::shared_ptr<ArAsset>& asset,
+            const std::shared_ptr<const char>& buffer);
+
+        /// Returns the opened package given to SetPackage, if any.
+        const std::shared_ptr<ArAsset>& GetPackageAsset() const
+        {
+            return _packageAsset;
+        }
+
+        /// Returns the package contents given to SetPackage, if any.
+        const std::shared_ptr<const char>& GetPackageBuffer() const
+        {
+            return _packageBuffer;
+        }
+
+        /// Returns the approximate number of bytes of memory used by this
+        /// index.
+        size_t GetMemoryUsage() const
+        {
+            return _memoryUsage;
+        }
+
+    private:
+        std::unordered_map<std::string, Member> _members;
+        std::shared_ptr<ArAsset> _packageAsset;
+        std::shared_ptr<const char> _packageBuffer;
+        size_t _memoryUsage;
+    };
+
+    using IndexConstPtr = std::shared_ptr<const Index>;
+
+    /// Returns the process-wide package index cache.
+    AR_API
+    static ArPackageIndexCache& GetInstance();
+
+    /// Returns the cached index for the package at \p resolvedPackagePath
+    /// if one was cached for the same \p timestamp, or nullptr otherwise.
+    /// An index cached for a different timestamp is discarded.
+    AR_API
+    IndexConstPtr Find(
+        const std::string& resolvedPackagePath,
+        const ArTimestamp& timestamp);
+
+    /// Caches \p index for the package at \p resolvedPackagePath with
+    /// the modification timestamp \p timestamp, replacing any previously
+    /// cached index for that package.
+    ///
+    /// If \p timestamp is invalid, there is no way to tell whether the
+    /// package has changed, so \p index is not cached.
+    AR_API
+    void Insert(
+        const std::string& resolvedPackagePath,
+        const ArTimestamp& timestamp,
+        const IndexConstPtr& index);
+
+    /// Discards the cached index for the package at \p resolvedPackagePath.
+    AR_API
+    void Remove(const std::string& resolvedPackagePath);
+
+    /// Discards all cached indexes.
+    AR_API
+    void Clear();
+
+    /// Sets the memory budget for this cache to \p numBytes, evicting
+    /// indexes as needed to satisfy it.
+    AR_API
+    void SetMemoryBudget(size_t numBytes);
+
+    /// Returns the memory budget for this cache in bytes.
+    AR_API
+    size_t GetMemoryBudget() const;
+
+    /// Returns the approximate number of bytes of memory used by all
+    /// indexes in this cache.
+    AR_API
+    size_t GetMemoryUsage() const;
+
+    /// Sets the maximum number of cached indexes that may hold an opened
+    /// package to \p numPackages, evicting indexes as needed to satisfy
+    /// it. Indexes without an opened package are not affected.
+    AR_API
+    void SetOpenPackageLimit(size_t numPackages);
+
+    /// Returns the maximum number of cached indexes that may hold an
+    /// opened package.
+    AR_API
+    size_t GetOpenPackageLimit() const;
+
+    /// Returns the number of cached indexes that hold an opened package.
+    AR_API
+    size_t GetNumOpenPackages() const;
+
+    ArPackageIndexCache(const ArPackageIndexCache&) = delete;
+    ArPackageIndexCache& operator=(const ArPackageIndexCache&) = delete;
+
+private:
+    ArPackageIndexCache();
+    ~ArPackageIndexCache();
+
+    void _HandleResolverChanged(const ArNotice::ResolverChanged& notice);
+
+    struct _Entry
+    {
+        std::string packagePath;
+        ArTimestamp timestamp;
+        IndexConstPtr index;
+    };
+
+    // Entries are ordered from most to least recently used.
+    using _EntryList = std::list<_Entry>;
+
+    // Evicts least recently used indexes until the memory budget and the
+    // open package limit are satisfied, moving them to \p removed. The
+    // mutex must be held by the caller.
+    void _EvictToBudget(_EntryList* removed);
+
+    // Removes the entry at \p entryIt from the cache, moving it to
+    // \p removed. Callers destroy \p removed after releasing the mutex,
+    // since destroying an index may close the package it holds. The mutex
+    // must be held by the caller.
+    void _RemoveEntry(_EntryList::iterator entryIt, _EntryList* removed);
+
+    mutable std::mutex _mutex;
+    _EntryList _entries;
+    std::unordered_map<std::string, _EntryList::iterator> _entryMap;
+    size_t _memoryUsage;
+    size_t _memoryBudget;
+    size_t _numOpenPackages;
+    size_t _openPackageLimit;
+};
+
+}  // namespace pxr
+
+#endif // PXR_AR_PACKAGE_INDEX_CACHE_H
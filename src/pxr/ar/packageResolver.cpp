@@ -6,6 +6,7 @@
 // Modified by Jeremy Retailleau.
 
 #include "./packageResolver.h"
+#include "./asset.h"
 
 #include <pxr/tf/registryManager.h>
 #include <pxr/tf/type.h>
@@ -25,4 +26,17 @@ ArPackageResolver::~ArPackageResolver()
 {
 }
 
+std::vector<std::shared_ptr<ArAsset>>
+ArPackageResolver::OpenAssets(
+    const std::string& resolvedPackagePath,
+    const std::vector<std::string>& resolvedPackagedPaths)
+{
+    std::vector<std::shared_ptr<ArAsset>> assets;
+    assets.reserve(resolvedPackagedPaths.size());
+    for (const std::string& resolvedPackagedPath : resolvedPackagedPaths) {
+        assets.push_back(OpenAsset(resolvedPackagePath, resolvedPackagedPath));
+    }
+    return assets;
+}
+
 }  // namespace pxr
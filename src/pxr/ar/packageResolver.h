@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace pxr {
 
@@ -127,6 +128,23 @@ public:
         const std::string& resolvedPackagePath,
         const std::string& resolvedPackagedPath) = 0;
 
+    /// Returns ArAsset objects for the assets at each path in
+    /// \p resolvedPackagedPaths located in the package asset at
+    /// \p resolvedPackagePath, in the same order. The result for any asset
+    /// that could not be opened is an invalid std::shared_ptr.
+    ///
+    /// This is called when a client expects to need many assets in the
+    /// same package. Implementations may override this to read all of the
+    /// requested assets in a single pass over the package rather than
+    /// reading the package piecemeal. The default implementation calls
+    /// OpenAsset for each path.
+    ///
+    /// \see ArResolver::OpenAssets
+    AR_API
+    virtual std::vector<std::shared_ptr<ArAsset>> OpenAssets(
+        const std::string& resolvedPackagePath,
+        const std::vector<std::string>& resolvedPackagedPaths);
+
     // --------------------------------------------------------------------- //
     /// \name Scoped Resolution Cache
     /// 
@@ -12,127 +12,307 @@
 #include <pxr/tf/stringUtils.h>
 
 #include <algorithm>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 namespace pxr {
 
 namespace
 {
-// Returns iterator in \p path pointing to outermost ']' delimiter.
-std::string::const_iterator
-_FindOutermostClosingDelimiter(const std::string& path)
+
+// Delimiter scanning
+//
+// Package-relative paths are scanned for the '[' and ']' delimiters and
+// the '\' escape character many times during resolution, so these scans
+// process a block of characters at a time using SSE2 or AVX2 when the
+// compiler targets them. Other platforms fall back to scanning each
+// character in turn.
+
+#if defined(__AVX2__)
+
+constexpr size_t _ScanBlockSize = 32;
+
+// Returns a mask with bit i set if \p data[i] is '[' or ']', or also '\'
+// if \p matchEscape is true.
+inline uint32_t
+_MatchBlock(const char* data, bool matchEscape)
 {
-    if (path.empty() || path.back() != ']') {
-        return path.end();
+    const __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    __m256i matches = _mm256_or_si256(
+        _mm256_cmpeq_epi8(block, _mm256_set1_epi8('[')),
+        _mm256_cmpeq_epi8(block, _mm256_set1_epi8(']')));
+    if (matchEscape) {
+        matches = _mm256_or_si256(
+            matches, _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\\')));
     }
-    return path.end() - 1;
+    return static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+}
+
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+constexpr size_t _ScanBlockSize = 16;
+
+// Returns a mask with bit i set if \p data[i] is '[' or ']', or also '\'
+// if \p matchEscape is true.
+inline uint32_t
+_MatchBlock(const char* data, bool matchEscape)
+{
+    const __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    __m128i matches = _mm_or_si128(
+        _mm_cmpeq_epi8(block, _mm_set1_epi8('[')),
+        _mm_cmpeq_epi8(block, _mm_set1_epi8(']')));
+    if (matchEscape) {
+        matches = _mm_or_si128(
+            matches, _mm_cmpeq_epi8(block, _mm_set1_epi8('\\')));
+    }
+    return static_cast<uint32_t>(_mm_movemask_epi8(matches));
+}
+
+#else
+
+constexpr size_t _ScanBlockSize = 0;
+
+inline uint32_t
+_MatchBlock(const char*, bool)
+{
+    return 0;
 }
 
-// Delete rvalue overload to avoid returning an iterator to a temporary.
-std::string::const_iterator
-_FindOutermostClosingDelimiter(std::string&& path) = delete;
+#endif
 
-// Returns iterator in \p path pointing to the innermost ']' delimiter.
-std::string::const_iterator
-_FindInnermostClosingDelimiter(const std::string& path)
+// Returns the index of the lowest set bit in the non-zero \p mask.
+inline size_t
+_LowestSetBit(uint32_t mask)
+{
+#if defined(_MSC_VER)
+    unsigned long idx;
+    _BitScanForward(&idx, mask);
+    return idx;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+// Returns the index of the highest set bit in the non-zero \p mask.
+inline size_t
+_HighestSetBit(uint32_t mask)
+{
+#if defined(_MSC_VER)
+    unsigned long idx;
+    _BitScanReverse(&idx, mask);
+    return idx;
+#else
+    return 31 - __builtin_clz(mask);
+#endif
+}
+
+inline bool
+_IsDelimiter(char c, bool matchEscape)
+{
+    return c == '[' || c == ']' || (matchEscape && c == '\\');
+}
+
+// Returns the index of the first '[' or ']' character in \p path in the
+// range [pos, end), or \p end if there is none. If \p matchEscape is true,
+// '\' characters are found as well.
+size_t
+_FindNextDelimiter(
+    std::string_view path, size_t pos, size_t end, bool matchEscape)
+{
+    const char* data = path.data();
+    if (_ScanBlockSize != 0) {
+        for (; pos + _ScanBlockSize <= end; pos += _ScanBlockSize) {
+            if (const uint32_t mask = _MatchBlock(data + pos, matchEscape)) {
+                return pos + _LowestSetBit(mask);
+            }
+        }
+    }
+
+    for (; pos < end; ++pos) {
+        if (_IsDelimiter(data[pos], matchEscape)) {
+            return pos;
+        }
+    }
+    return end;
+}
+
+// Returns the index of the last '[' or ']' character in \p path before
+// \p end, or npos if there is none.
+size_t
+_FindPrevDelimiter(std::string_view path, size_t end)
+{
+    const char* data = path.data();
+    if (_ScanBlockSize != 0) {
+        for (; end >= _ScanBlockSize; end -= _ScanBlockSize) {
+            const size_t blockStart = end - _ScanBlockSize;
+            if (const uint32_t mask = _MatchBlock(data + blockStart, false)) {
+                return blockStart + _HighestSetBit(mask);
+            }
+        }
+    }
+
+    while (end-- != 0) {
+        if (_IsDelimiter(data[end], false)) {
+            return end;
+        }
+    }
+    return std::string_view::npos;
+}
+
+// Returns index in \p path of the outermost ']' delimiter, or npos if
+// there is none.
+size_t
+_FindOutermostClosingDelimiter(std::string_view path)
 {
     if (path.empty() || path.back() != ']') {
-        return path.end();
+        return std::string_view::npos;
     }
+    return path.size() - 1;
+}
 
-    for (auto it = path.rbegin(); it != path.rend(); ++it) {
-        if (*it == '\\') {
-            // The previous ']' character was escaped, so the innermost
-            // delimiter is really the one before that character.
-            return (it - 1).base();
+// Returns index in \p path of the innermost ']' delimiter, or npos if
+// there is none.
+size_t
+_FindInnermostClosingDelimiter(std::string_view path)
+{
+    if (path.empty() || path.back() != ']') {
+        return std::string_view::npos;
+    }
+
+    for (size_t i = path.size(); i-- != 0; ) {
+        if (path[i] == '\\') {
+            // The next ']' character was escaped, so the innermost
+            // delimiter is really the one after that character.
+            return (i + 2 < path.size()) ? i + 2 : std::string_view::npos;
         }
-        else if (*it != ']') {
-            return it.base();
+        else if (path[i] != ']') {
+            return i + 1;
         }
     }
 
-    return path.end();
+    return std::string_view::npos;
 }
 
-// Delete rvalue overload to avoid returning an iterator to a temporary.
-std::string::const_iterator
-_FindInnermostClosingDelimiter(std::string&& path) = delete;
-
-// Given iterator \p closingDelimIt in \p path pointing to a closing
-// ']' character, returns iterator to the corresponding opening '['
-// character, or path.end() if one can't be found.
-std::string::const_iterator
-_FindMatchingOpeningDelimiter(
-    const std::string& path,
-    std::string::const_iterator closingDelimIt)
+// Given index \p closingDelimIdx in \p path of a closing ']' character,
+// returns index of the corresponding opening '[' character, or npos if
+// one can't be found.
+size_t
+_FindMatchingOpeningDelimiter(std::string_view path, size_t closingDelimIdx)
 {
     size_t numOpenNeeded = 1;
-    std::string::const_reverse_iterator revIt(closingDelimIt);
-    for (; revIt != path.rend() && numOpenNeeded != 0; ++revIt) {
-        if (*revIt == '[' || *revIt == ']') {
-            // Ignore this delimiter if it's been escaped.
-            auto prevCharIt = revIt + 1;
-            if (prevCharIt != path.rend() && *prevCharIt == '\\') {
-                continue;
-            }
-            numOpenNeeded += (*revIt == '[') ? -1 : 1;
+    for (size_t i = _FindPrevDelimiter(path, closingDelimIdx);
+         i != std::string_view::npos; i = _FindPrevDelimiter(path, i)) {
+        // Ignore this delimiter if it's been escaped.
+        if (i != 0 && path[i - 1] == '\\') {
+            continue;
+        }
+        numOpenNeeded += (path[i] == '[') ? -1 : 1;
+        if (numOpenNeeded == 0) {
+            return i;
         }
     }
 
-    return (numOpenNeeded == 0) ? revIt.base() : path.end();
+    return std::string_view::npos;
 }
 
-// Escape delimiters in the given path to preserve them when placing
-// placing the path into the packaged part of a package-relative path.
+// Returns the end of the range in \p path where delimiters need to be
+// escaped or unescaped.
 //
 // If path is a package-relative path, we assume the packaged portion of
 // that path has already been escaped and only process the package portion.
-std::string
-_EscapeDelimiters(const std::string& path)
+size_t
+_GetEscapeRangeEnd(std::string_view path)
 {
-    if (path.empty()) {
-        return path;
+    if (!path.empty() && path.back() == ']') {
+        const size_t outermostOpenIdx = 
+            _FindMatchingOpeningDelimiter(path, path.size() - 1);
+        if (outermostOpenIdx != std::string_view::npos) {
+            return outermostOpenIdx;
+        }
     }
+    return path.size();
+}
 
-    auto escapeRangeBegin = path.begin(), escapeRangeEnd = path.end();
-    if (path.back() == ']') {
-        auto outermostOpenIt = 
-            _FindMatchingOpeningDelimiter(path, path.end() - 1);
-        if (outermostOpenIt != path.end()) {
-            escapeRangeEnd = outermostOpenIt;
+// Escape delimiters in the given path to preserve them when placing
+// placing the path into the packaged part of a package-relative path.
+std::string
+_EscapeDelimiters(std::string_view path)
+{
+    const size_t escapeRangeEnd = _GetEscapeRangeEnd(path);
+
+    std::string escapedString;
+    escapedString.reserve(path.size());
+    for (size_t i = 0; i < escapeRangeEnd; ) {
+        const size_t delimIdx =
+            _FindNextDelimiter(path, i, escapeRangeEnd, false);
+        escapedString.append(path.substr(i, delimIdx - i));
+        if (delimIdx == escapeRangeEnd) {
+            break;
         }
+        escapedString += '\\';
+        escapedString += path[delimIdx];
+        i = delimIdx + 1;
     }
+    escapedString.append(path.substr(escapeRangeEnd));
+    return escapedString;
+}
 
-    std::string escapedString(escapeRangeBegin, escapeRangeEnd);
-    escapedString = TfStringReplace(escapedString, "[", "\\[");
-    escapedString = TfStringReplace(escapedString, "]", "\\]");
-    return escapedString + std::string(escapeRangeEnd, path.end());
+// Returns true if the given path contains escaped delimiters that need to
+// be unescaped by _UnescapeDelimiters.
+bool
+_HasEscapedDelimiters(std::string_view path)
+{
+    const size_t escapeRangeEnd = _GetEscapeRangeEnd(path);
+    for (size_t i = path.find('\\');
+         i != std::string_view::npos && i + 1 < escapeRangeEnd;
+         i = path.find('\\', i + 1)) {
+        if (path[i + 1] == '[' || path[i + 1] == ']') {
+            return true;
+        }
+    }
+    return false;
 }
 
 // Unescape delimiters in the given path to give clients the 'real' path
 // when extracting paths from the packaged part of a package-relative path.
-//
-// If path is a package-relative path, we assume the packaged portion of
-// that path has already been escaped and only process the package portion.
 std::string
-_UnescapeDelimiters(const std::string& path)
+_UnescapeDelimiters(std::string_view path)
 {
-    if (path.empty()) {
-        return path;
-    }
+    const size_t escapeRangeEnd = _GetEscapeRangeEnd(path);
+
+    std::string unescapedString;
+    unescapedString.reserve(path.size());
+    for (size_t i = 0; i < escapeRangeEnd; ) {
+        const size_t delimIdx =
+            _FindNextDelimiter(path, i, escapeRangeEnd, true);
+        unescapedString.append(path.substr(i, delimIdx - i));
+        if (delimIdx == escapeRangeEnd) {
+            break;
+        }
 
-    auto escapeRangeBegin = path.begin(), escapeRangeEnd = path.end();
-    if (path.back() == ']') {
-        auto outermostOpenIt = 
-            _FindMatchingOpeningDelimiter(path, path.end() - 1);
-        if (outermostOpenIt != path.end()) {
-            escapeRangeEnd = outermostOpenIt;
+        // Drop the '\' before an escaped delimiter but keep everything
+        // else, including the delimiter itself.
+        if (path[delimIdx] != '\\' || delimIdx + 1 >= escapeRangeEnd ||
+            (path[delimIdx + 1] != '[' && path[delimIdx + 1] != ']')) {
+            unescapedString += path[delimIdx];
         }
+        i = delimIdx + 1;
     }
-
-    std::string escapedString(escapeRangeBegin, escapeRangeEnd);
-    escapedString = TfStringReplace(escapedString, "\\[", "[");
-    escapedString = TfStringReplace(escapedString, "\\]", "]");
-    return escapedString + std::string(escapeRangeEnd, path.end());
+    unescapedString.append(path.substr(escapeRangeEnd));
+    return unescapedString;
 }
 
 } // end anonymous namespace
@@ -142,7 +322,8 @@ ArIsPackageRelativePath(
     const std::string& path)
 {
     return !path.empty() && path.back() == ']' && 
-        _FindMatchingOpeningDelimiter(path, path.end() - 1) != path.end();
+        _FindMatchingOpeningDelimiter(path, path.size() - 1) !=
+            std::string_view::npos;
 }
 
 namespace
@@ -232,61 +413,136 @@ ArJoinPackageRelativePath(
     return _JoinPackageRelativePath(arr, arr + 2);
 }
 
-std::pair<std::string, std::string>
-ArSplitPackageRelativePathOuter(
-    const std::string& path)
+std::string
+ArPackageRelativePathSplit::GetPackagePath() const
+{
+    std::string result;
+    result.reserve(packagePath.size() + packagePathSuffix.size());
+    result.append(packagePath);
+    result.append(packagePathSuffix);
+    return result;
+}
+
+std::string
+ArPackageRelativePathSplit::GetPackagedPath() const
 {
+    return packagedPathIsEscaped ?
+        _UnescapeDelimiters(packagedPath) : std::string(packagedPath);
+}
+
+ArPackageRelativePathSplit
+ArSplitPackageRelativePathOuterView(std::string_view path)
+{
+    ArPackageRelativePathSplit result;
+    result.packagePath = path;
+
     // For example, given a path like "/dir/foo.package[bar.package[baz.file]]",
-    // find the range [outermostOpenIt, outermostCloseIt] containing 
+    // find the range [outermostOpenIdx, outermostCloseIdx] containing 
     // "[bar.package[baz.file]]"
-    auto outermostCloseIt = _FindOutermostClosingDelimiter(path);
-    if (outermostCloseIt == path.end()) {
-        return std::make_pair(path, std::string());
+    const size_t outermostCloseIdx = _FindOutermostClosingDelimiter(path);
+    if (outermostCloseIdx == std::string_view::npos) {
+        return result;
     }
-    auto outermostOpenIt = _FindMatchingOpeningDelimiter(path, outermostCloseIt);
-    if (outermostOpenIt == path.end()) {
-        return std::make_pair(path, std::string());
+    const size_t outermostOpenIdx =
+        _FindMatchingOpeningDelimiter(path, outermostCloseIdx);
+    if (outermostOpenIdx == std::string_view::npos) {
+        return result;
     }
 
     // The package path is everything before the outermost opening delimiter.
-    std::string packagePath(path.begin(), outermostOpenIt);
+    result.packagePath = path.substr(0, outermostOpenIdx);
 
-    // Drop the opening and closing delimiters to create the packaged path,
-    // making sure to unescape delimiters now that this path has been split.
-    std::string packagedPath(outermostOpenIt + 1, outermostCloseIt);
-    packagedPath = _UnescapeDelimiters(packagedPath);
+    // Drop the opening and closing delimiters to create the packaged path.
+    // Delimiters in this path need to be unescaped now that it has been
+    // split, but only if there are any.
+    result.packagedPath = path.substr(
+        outermostOpenIdx + 1, outermostCloseIdx - outermostOpenIdx - 1);
+    result.packagedPathIsEscaped = _HasEscapedDelimiters(result.packagedPath);
 
-    return std::make_pair(std::move(packagePath), std::move(packagedPath));
+    return result;
+}
+
+ArPackageRelativePathSplit
+ArSplitPackageRelativePathInnerView(std::string_view path)
+{
+    ArPackageRelativePathSplit result;
+    result.packagePath = path;
+
+    // For example, given a path like "/dir/foo.package[bar.package[baz.file]]",
+    // find the range [innermostOpenIdx, innermostCloseIdx] containing 
+    // "[baz.file]"
+    const size_t innermostCloseIdx = _FindInnermostClosingDelimiter(path);
+    if (innermostCloseIdx == std::string_view::npos) {
+        return result;
+    }
+    const size_t innermostOpenIdx =
+        _FindMatchingOpeningDelimiter(path, innermostCloseIdx);
+    if (innermostOpenIdx == std::string_view::npos) {
+        return result;
+    }
+
+    // The package path is the given path with "[baz.file]" removed.
+    result.packagePath = path.substr(0, innermostOpenIdx);
+    result.packagePathSuffix = path.substr(innermostCloseIdx + 1);
+
+    // Drop the opening and closing delimiters to create the packaged path.
+    // Delimiters in this path need to be unescaped now that it has been
+    // split, but only if there are any.
+    result.packagedPath = path.substr(
+        innermostOpenIdx + 1, innermostCloseIdx - innermostOpenIdx - 1);
+    result.packagedPathIsEscaped = _HasEscapedDelimiters(result.packagedPath);
+
+    return result;
+}
+
+std::pair<std::string, std::string>
+ArSplitPackageRelativePathOuter(
+    const std::string& path)
+{
+    const ArPackageRelativePathSplit split =
+        ArSplitPackageRelativePathOuterView(path);
+    return std::make_pair(split.GetPackagePath(), split.GetPackagedPath());
 }
 
 std::pair<std::string, std::string>
 ArSplitPackageRelativePathInner(
     const std::string& path)
 {
-    // For example, given a path like "/dir/foo.package[bar.package[baz.file]]",
-    // find the range [innermostOpenIt, innermostCloseIt] containing 
-    // "[baz.file]"
-    auto innermostCloseIt = _FindInnermostClosingDelimiter(path);
-    if (innermostCloseIt == path.end()) {
-        return std::make_pair(path, std::string());
+    const ArPackageRelativePathSplit split =
+        ArSplitPackageRelativePathInnerView(path);
+    return std::make_pair(split.GetPackagePath(), split.GetPackagedPath());
+}
+
+ArPackageRelativePath::ArPackageRelativePath(std::string_view path)
+{
+    _segments.clear();
+
+    // Split off the outermost package path at each level. The packaged
+    // path only needs to be copied when it contains escaped delimiters;
+    // otherwise we can keep splitting the original path.
+    std::string unescapedPackagedPath;
+    std::string_view remainingPath = path;
+    while (true) {
+        const ArPackageRelativePathSplit split =
+            ArSplitPackageRelativePathOuterView(remainingPath);
+        if (_segments.empty()) {
+            _isPackageRelativePath = 
+                split.packagePath.size() != remainingPath.size();
+        }
+
+        _segments.emplace_back(split.packagePath);
+        if (split.packagedPath.empty()) {
+            break;
+        }
+
+        if (split.packagedPathIsEscaped) {
+            unescapedPackagedPath = split.GetPackagedPath();
+            remainingPath = unescapedPackagedPath;
+        }
+        else {
+            remainingPath = split.packagedPath;
+        }
     }
-    auto innermostOpenIt = _FindMatchingOpeningDelimiter(path, innermostCloseIt);
-    if (innermostOpenIt == path.end()) {
-        return std::make_pair(path, std::string());
-    }        
-
-    // Erase "[baz.file]" from the given path to generate the package path.
-    std::string packagePath = path;
-    packagePath.erase(
-        std::distance(path.begin(), innermostOpenIt),
-        std::distance(innermostOpenIt, innermostCloseIt) + 1);
-
-    // Drop the opening and closing delimiters to create the packaged path,
-    // making sure to unescape delimiters now that this path has been split.
-    std::string packagedPath(innermostOpenIt + 1, innermostCloseIt);
-    packagedPath = _UnescapeDelimiters(packagedPath);
-
-    return std::make_pair(std::move(packagePath), std::move(packagedPath));
 }
 
 }  // namespace pxr
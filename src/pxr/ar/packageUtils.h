@@ -14,6 +14,8 @@
 #include "./api.h"
 
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace pxr {
@@ -110,6 +112,116 @@ AR_API
 std::pair<std::string, std::string>
 ArSplitPackageRelativePathInner(const std::string& path);
 
+/// \struct ArPackageRelativePathSplit
+///
+/// Non-owning result of splitting a package-relative path with
+/// ArSplitPackageRelativePathOuterView or ArSplitPackageRelativePathInnerView.
+/// The views refer to the path that was split, which must outlive this
+/// object.
+///
+/// The package path is \p packagePath followed by \p packagePathSuffix.
+/// The suffix is only non-empty when splitting at the innermost packaged
+/// path, where it holds the closing delimiters that follow the innermost
+/// packaged path. \p packagedPath still contains any escaped delimiters
+/// from the original path; \p packagedPathIsEscaped is true if these need
+/// to be unescaped to produce the packaged path. This lets callers that
+/// only need to inspect the components avoid any allocations.
+struct ArPackageRelativePathSplit
+{
+    std::string_view packagePath;
+    std::string_view packagePathSuffix;
+    std::string_view packagedPath;
+    bool packagedPathIsEscaped = false;
+
+    /// Returns the package path as a string.
+    AR_API
+    std::string GetPackagePath() const;
+
+    /// Returns the packaged path as a string, unescaping delimiters if
+    /// needed.
+    AR_API
+    std::string GetPackagedPath() const;
+};
+
+/// Split package-relative path \p path at its outermost package path
+/// without allocating. This is equivalent to
+/// ArSplitPackageRelativePathOuter, which is implemented in terms of
+/// this function.
+///
+/// If \p path is not a package-relative path, the returned package path
+/// is \p path and the packaged path is empty.
+AR_API
+ArPackageRelativePathSplit
+ArSplitPackageRelativePathOuterView(std::string_view path);
+
+/// Split package-relative path \p path at its innermost packaged path
+/// without allocating. This is equivalent to
+/// ArSplitPackageRelativePathInner, which is implemented in terms of
+/// this function.
+///
+/// If \p path is not a package-relative path, the returned package path
+/// is \p path and the packaged path is empty.
+AR_API
+ArPackageRelativePathSplit
+ArSplitPackageRelativePathInnerView(std::string_view path);
+
+/// \class ArPackageRelativePath
+///
+/// A package-relative path parsed into its nested segments.
+///
+/// Splitting a nested package-relative path one level at a time with
+/// ArSplitPackageRelativePathOuter rescans the remaining path at every
+/// level. This class parses the path once into the list of its segments,
+/// from the outermost package path to the innermost packaged path, so
+/// that code walking through the nested packages can do so in a single
+/// pass.
+///
+/// \code
+/// ArPackageRelativePath("a.pack[b.pack[c.file]]").GetSegments()
+///    => ["a.pack", "b.pack", "c.file"]
+/// \endcode
+class ArPackageRelativePath
+{
+public:
+    ArPackageRelativePath() = default;
+
+    /// Parses \p path into its segments. If \p path is not a
+    /// package-relative path, the only segment is \p path itself.
+    AR_API
+    explicit ArPackageRelativePath(std::string_view path);
+
+    /// Returns true if the parsed path was a package-relative path.
+    bool IsPackageRelativePath() const
+    {
+        return _isPackageRelativePath;
+    }
+
+    /// Returns the segments of the parsed path, beginning with the
+    /// outermost package path. Delimiters in each segment are unescaped.
+    /// Empty packaged paths, e.g. in "a.pack[]", are not included.
+    const std::vector<std::string>& GetSegments() const
+    {
+        return _segments;
+    }
+
+    /// Returns the outermost package path.
+    const std::string& GetOuterPackagePath() const
+    {
+        return _segments.front();
+    }
+
+    /// Returns the innermost packaged path, or the outermost package path
+    /// if the parsed path is not a package-relative path.
+    const std::string& GetInnermostPackagedPath() const
+    {
+        return _segments.back();
+    }
+
+private:
+    std::vector<std::string> _segments = std::vector<std::string>(1);
+    bool _isPackageRelativePath = false;
+};
+
 /// @}
 
 }  // namespace pxr
@@ -7,6 +7,7 @@
 
 #include "./asset.h"
 #include "./assetInfo.h"
+#include "./cacheScopeUtils.h"
 #include "./debugCodes.h"
 #include "./defaultResolver.h"
 #include "./definePackageResolver.h"
@@ -16,7 +17,9 @@
 #include "./resolvedPath.h"
 #include "./resolver.h"
 #include "./threadLocalScopedCache.h"
+#include "./writableAsset.h"
 
+#include <pxr/arch/defines.h>
 #include <pxr/vt/value.h>
 #include <pxr/plug/plugin.h>
 #include <pxr/plug/registry.h>
@@ -36,10 +39,14 @@
 
 #include <tbb/concurrent_hash_map.h>
 
+#include <algorithm>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <set>
 #include <string>
+#include <string_view>
+#include <typeinfo>
 #include <unordered_map>
 #include <vector>
 
@@ -452,6 +459,30 @@ public:
         _InitializePrimaryResolver(availableResolvers);
         _InitializeURIResolvers(availableResolvers);
         _InitializePackageResolvers();
+
+        // Without URI/IRI resolvers, the primary resolver handles every
+        // path, so calls can go straight to it instead of looking up the
+        // resolver for each path.
+        if (_uriResolvers.empty()) {
+            _primaryOnlyResolver = _resolver->Get();
+        }
+
+        // If the primary resolver is an ArDefaultResolver and not a
+        // subclass, paths are resolved by calling its implementation
+        // directly rather than through a virtual call.
+        ArResolver* primaryResolver = _resolver->Get();
+        if (primaryResolver &&
+            typeid(*primaryResolver) == typeid(ArDefaultResolver)) {
+            _primaryDefaultResolver =
+                static_cast<ArDefaultResolver*>(primaryResolver);
+        }
+
+        TF_DEBUG(AR_RESOLVER_INIT).Msg(
+            "ArGetResolver(): %s%s\n", _primaryOnlyResolver ?
+            "No URI/IRI resolvers, dispatching to primary resolver directly" :
+            "Dispatching to URI/IRI resolvers by scheme",
+            _primaryDefaultResolver ?
+            ", calling ArDefaultResolver without virtual dispatch" : "");
     }
 
     ArResolver& GetPrimaryResolver()
@@ -473,10 +504,16 @@ public:
         return uriSchemes;
     }
 
+    bool IsCacheScopeActive() const
+    {
+        return _threadCache.BorrowCurrentCache() != nullptr;
+    }
+
     const ArResolverContext* GetInternallyManagedCurrentContext() const
     {
-        _ContextStack& contextStack = _threadContextStack.local();
-        return contextStack.empty() ? nullptr : contextStack.back();
+        const _ContextStack& contextStack = _threadContextStack.Local();
+        return contextStack.size == 0 ?
+            nullptr : &contextStack.bindings[contextStack.size - 1].context;
     }
 
     ArResolverContext CreateContextFromString(
@@ -559,8 +596,16 @@ public:
         // packaged path syntax is fully under Ar's control, we might not
         // dispatch to any other resolver in this case and just anchor
         // the packaged path and given assetPath ourselves.
-        const ArResolvedPath anchorResolvedPath(
-            ArSplitPackageRelativePathOuter(anchorAssetPath).first);
+        // Only split the anchor when needed, since this is called for
+        // every asset path and most anchors aren't package-relative.
+        const bool anchorIsPackageRelative =
+            ArIsPackageRelativePath(anchorAssetPath);
+        const ArResolvedPath anchorPackagePath = anchorIsPackageRelative ?
+            ArResolvedPath(
+                ArSplitPackageRelativePathOuter(anchorAssetPath).first) :
+            ArResolvedPath();
+        const ArResolvedPath& anchorResolvedPath =
+            anchorIsPackageRelative ? anchorPackagePath : anchorAssetPath;
 
         if (ArIsPackageRelativePath(assetPath)) {
             std::pair<std::string, std::string> packageAssetPath =
@@ -603,7 +648,6 @@ public:
 
     std::string _GetExtension(const std::string& path) const final
     {
-        ArResolver& resolver = _GetResolver(path);
         if (ArIsPackageRelativePath(path)) {
             // We expect clients of this API will primarily care about the
             // *packaged* asset, so we return the extension of the inner-most
@@ -611,33 +655,47 @@ public:
             // extension can split the package-relative path and call this
             // function on the package path.
             //
-            // XXX: This doesn't seem right. If Ar is defining the packaged
-            // path syntax, then Ar should be responsible for getting the
-            // extension for packaged paths instead of delegating.
-            const std::pair<std::string, std::string> packagePath =
-                ArSplitPackageRelativePathInner(path);
-            return resolver.GetExtension(packagePath.second);
+            // Ar defines the packaged path syntax, so it determines the
+            // extension itself using the same rule used to select package
+            // resolvers in _GetPackageResolverForPackagedPath.
+            const ArPackageRelativePathSplit split =
+                ArSplitPackageRelativePathInnerView(path);
+            if (!split.packagedPathIsEscaped) {
+                return std::string(_GetExtensionView(split.packagedPath));
+            }
+            return std::string(_GetExtensionView(split.GetPackagedPath()));
         }
-        return resolver.GetExtension(path);
+        return _GetResolver(path).GetExtension(path);
     }
 
     // The primary resolver and the URI/IRI resolvers all participate
     // in context binding and may have context-related data to store
-    // away. To accommodate this, _Resolve stores away a vector of
-    // VtValues where each element corresponds to the primary resolver
-    // or a URI/IRI resolver.
-    using _ResolverContextData = std::vector<VtValue>;
-
+    // away. This data is kept in the binding's entry in the per-thread
+    // context stack rather than in bindingData. Entries are reused, so
+    // binding and unbinding don't allocate once a thread has reached a
+    // given binding depth.
+    //
+    // The entry holds a copy of the bound context, so callers don't need
+    // to keep their context alive while it is bound. Since contexts share
+    // interned storage, copying one only bumps a reference count.
     void _BindContext(
         const ArResolverContext& context,
         VtValue* bindingData) final
     {
-        _ResolverContextData contextData(1 + _uriResolvers.size());
+        _ContextStack& contextStack = _threadContextStack.Local();
+        if (contextStack.size == contextStack.bindings.size()) {
+            contextStack.bindings.emplace_back();
+        }
+
+        _ContextBinding& binding = contextStack.bindings[contextStack.size++];
+        binding.context = context;
+        binding.resolverData.resize(1 + _uriResolvers.size());
 
         size_t dataIndex = 0;
 
         if (_resolver->info.implementsContexts) {
-            _resolver->Get()->BindContext(context, &contextData[dataIndex]);
+            _resolver->Get()->BindContext(
+                binding.context, &binding.resolverData[dataIndex]);
             ++dataIndex;
         }
 
@@ -647,32 +705,43 @@ public:
             }
 
             if (ArResolver* uriResolver = entry.second->Get()) {
-                uriResolver->BindContext(context, &contextData[dataIndex]);
+                uriResolver->BindContext(
+                    binding.context, &binding.resolverData[dataIndex]);
             }
             ++dataIndex;
         }
-
-        bindingData->Swap(contextData);
-
-        _ContextStack& contextStack = _threadContextStack.local();
-        contextStack.push_back(&context);
     }
 
     void _UnbindContext(
         const ArResolverContext& context,
         VtValue* bindingData) final
     {
-        if (!TF_VERIFY(bindingData->IsHolding<_ResolverContextData>())) {
+        _ContextStack& contextStack = _threadContextStack.Local();
+        if (contextStack.size == 0) {
+            TF_CODING_ERROR(
+                "No context was bound, cannot unbind context: %s",
+                context.GetDebugString().c_str());
             return;
         }
 
-        _ResolverContextData contextData;
-        bindingData->UncheckedSwap(contextData);
+        // Contexts are normally unbound in the reverse order they were
+        // bound, but look for the given context further down the stack
+        // in case they weren't.
+        size_t bindingIndex = contextStack.size - 1;
+        for (size_t i = contextStack.size; i-- != 0; ) {
+            if (contextStack.bindings[i].context == context) {
+                bindingIndex = i;
+                break;
+            }
+        }
+
+        _ContextBinding& binding = contextStack.bindings[bindingIndex];
 
         size_t dataIndex = 0;
 
         if (_resolver->info.implementsContexts) {
-            _resolver->Get()->UnbindContext(context, &contextData[dataIndex]);
+            _resolver->Get()->UnbindContext(
+                binding.context, &binding.resolverData[dataIndex]);
             ++dataIndex;
         }
 
@@ -682,22 +751,24 @@ public:
             }
 
             if (ArResolver* uriResolver = entry.second->Get()) {
-                uriResolver->UnbindContext(context, &contextData[dataIndex]);
+                uriResolver->UnbindContext(
+                    binding.context, &binding.resolverData[dataIndex]);
             }
             ++dataIndex;
         }
 
-        bindingData->UncheckedSwap(contextData);
-
-        _ContextStack& contextStack = _threadContextStack.local();
-        if (contextStack.empty()) {
-            TF_CODING_ERROR(
-                "No context was bound, cannot unbind context: %s",
-                context.GetDebugString().c_str());
-        }
-        else {
-            contextStack.pop_back();
+        binding.context = ArResolverContext();
+        for (VtValue& data : binding.resolverData) {
+            data = VtValue();
         }
+
+        // Move the now unused entry to the top of the stack so it can
+        // be reused by the next binding.
+        std::rotate(
+            contextStack.bindings.begin() + bindingIndex,
+            contextStack.bindings.begin() + bindingIndex + 1,
+            contextStack.bindings.begin() + contextStack.size);
+        --contextStack.size;
     }
 
     ArResolverContext _CreateDefaultContext() const final
@@ -786,10 +857,19 @@ public:
         // the results of calling GetCurrentContext on each resolver
         // implementation and merge that over the contexts we're
         // managing internally.
+        //
+        // Empty contexts are skipped so that in the common case of a single
+        // non-empty context, it can be returned without combining contexts.
         std::vector<ArResolverContext> contexts;
 
+        auto addContext = [&contexts](ArResolverContext&& ctx) {
+            if (!ctx.IsEmpty()) {
+                contexts.push_back(std::move(ctx));
+            }
+        };
+
         if (_resolver->info.implementsContexts) {
-            contexts.push_back(_resolver->Get()->GetCurrentContext());
+            addContext(_resolver->Get()->GetCurrentContext());
         }
 
         for (const auto& entry : _uriResolvers) {
@@ -798,37 +878,31 @@ public:
             }
 
             if (ArResolver* uriResolver = entry.second->Get()) {
-                contexts.push_back(uriResolver->GetCurrentContext());
+                addContext(uriResolver->GetCurrentContext());
             }
         }
 
         if (const ArResolverContext* ctx = 
                 GetInternallyManagedCurrentContext()) {
-            contexts.push_back(*ctx);
+            addContext(ArResolverContext(*ctx));
         }
 
-        return ArResolverContext(contexts);
+        return contexts.size() == 1 ?
+            std::move(contexts.front()) : ArResolverContext(contexts);
     }
 
     ArResolvedPath _Resolve(
         const std::string& assetPath) const final
     {
+        if (_primaryOnlyResolver && !ArIsPackageRelativePath(assetPath)) {
+            return _ResolveWithResolver(
+                *_primaryOnlyResolver, _resolver->info, assetPath);
+        }
+
         auto resolveFn = [this](const std::string& path) {
             const _ResolverInfo* info = nullptr;
             ArResolver& resolver = _GetResolver(path, &info);
-
-            if (!info->implementsScopedCaches) {
-                if (_CachePtr currentCache = _threadCache.GetCurrentCache()) {
-                    _Cache::_PathToResolvedPathMap::accessor accessor;
-                    if (currentCache->_pathToResolvedPathMap.insert(
-                            accessor, std::make_pair(path, ArResolvedPath()))) {
-                        accessor->second = resolver.Resolve(path);
-                    }
-                    return accessor->second;
-                }
-            }
-
-            return resolver.Resolve(path);
+            return _ResolveWithResolver(resolver, *info, path);
         };
 
         return _ResolveHelper(assetPath, resolveFn);
@@ -896,20 +970,115 @@ public:
     { 
         ArResolver& resolver = _GetResolver(resolvedPath);
         if (ArIsPackageRelativePath(resolvedPath)) {
-            const std::pair<std::string, std::string> resolvedPackagePath =
-                ArSplitPackageRelativePathInner(resolvedPath);
+            const ArPackageRelativePathSplit resolvedPackagePath =
+                ArSplitPackageRelativePathInnerView(
+                    resolvedPath.GetPathString());
+            const std::string packagePath =
+                resolvedPackagePath.GetPackagePath();
 
             ArPackageResolver* packageResolver = 
-                _GetPackageResolver(resolvedPackagePath.first);
+                _GetPackageResolver(packagePath);
             if (packageResolver) {
                 return packageResolver->OpenAsset(
-                    resolvedPackagePath.first, resolvedPackagePath.second);
+                    packagePath, resolvedPackagePath.GetPackagedPath());
             }
             return nullptr;
         }
         return resolver.OpenAsset(resolvedPath);
     }
 
+    std::vector<std::shared_ptr<ArAsset>> _OpenAssets(
+        const std::vector<ArResolvedPath>& resolvedPaths) const final
+    {
+        // Group assets in the same package so they can be opened with a
+        // single call to the package resolver, and group all other assets
+        // by the resolver responsible for them. Groups are kept in the
+        // order they are first encountered.
+        struct _PackageGroup
+        {
+            std::string packagePath;
+            std::vector<std::string> packagedPaths;
+            std::vector<size_t> indexes;
+        };
+        std::vector<_PackageGroup> packageGroups;
+        std::unordered_map<std::string, size_t> packageGroupIndexes;
+
+        struct _ResolverGroup
+        {
+            ArResolver* resolver;
+            std::vector<ArResolvedPath> resolvedPaths;
+            std::vector<size_t> indexes;
+        };
+        std::vector<_ResolverGroup> resolverGroups;
+
+        for (size_t i = 0, e = resolvedPaths.size(); i != e; ++i) {
+            const ArResolvedPath& resolvedPath = resolvedPaths[i];
+            if (ArIsPackageRelativePath(resolvedPath)) {
+                const ArPackageRelativePathSplit resolvedPackagePath =
+                    ArSplitPackageRelativePathInnerView(
+                        resolvedPath.GetPathString());
+                std::string packagePath = resolvedPackagePath.GetPackagePath();
+
+                const auto groupIt = packageGroupIndexes.emplace(
+                    packagePath, packageGroups.size()).first;
+                if (groupIt->second == packageGroups.size()) {
+                    packageGroups.push_back({ std::move(packagePath) });
+                }
+
+                _PackageGroup& group = packageGroups[groupIt->second];
+                group.packagedPaths.push_back(
+                    resolvedPackagePath.GetPackagedPath());
+                group.indexes.push_back(i);
+                continue;
+            }
+
+            ArResolver* resolver = &_GetResolver(resolvedPath);
+            auto groupIt = std::find_if(
+                resolverGroups.begin(), resolverGroups.end(),
+                [resolver](const _ResolverGroup& group) {
+                    return group.resolver == resolver;
+                });
+            if (groupIt == resolverGroups.end()) {
+                groupIt = resolverGroups.insert(
+                    resolverGroups.end(), _ResolverGroup{ resolver });
+            }
+
+            groupIt->resolvedPaths.push_back(resolvedPath);
+            groupIt->indexes.push_back(i);
+        }
+
+        std::vector<std::shared_ptr<ArAsset>> assets(resolvedPaths.size());
+
+        for (const _PackageGroup& group : packageGroups) {
+            ArPackageResolver* packageResolver = 
+                _GetPackageResolver(group.packagePath);
+            if (!packageResolver) {
+                continue;
+            }
+
+            std::vector<std::shared_ptr<ArAsset>> groupAssets =
+                packageResolver->OpenAssets(
+                    group.packagePath, group.packagedPaths);
+            const size_t numAssets =
+                std::min(groupAssets.size(), group.indexes.size());
+            for (size_t i = 0; i != numAssets; ++i) {
+                assets[group.indexes[i]] = std::move(groupAssets[i]);
+            }
+        }
+
+        for (const _ResolverGroup& group : resolverGroups) {
+            std::vector<std::shared_ptr<ArAsset>> groupAssets =
+                group.resolver->OpenAssets(group.resolvedPaths);
+            const size_t numAssets =
+                std::min(groupAssets.size(), group.indexes.size());
+            for (size_t i = 0; i != numAssets; ++i) {
+                assets[group.indexes[i]] = std::move(groupAssets[i]);
+            }
+        }
+
+        return assets;
+    }
+
     std::shared_ptr<ArWritableAsset> _OpenAssetForWrite(
         const ArResolvedPath& resolvedPath,
         WriteMode mode) const final
@@ -936,6 +1105,31 @@ public:
         return resolver.CanWriteAssetToPath(resolvedPath, whyNot);
     }
 
+    bool _CopyAsset(
+        const ArResolvedPath& srcResolvedPath,
+        const ArResolvedPath& dstResolvedPath,
+        WriteMode mode) const final
+    {
+        if (ArIsPackageRelativePath(dstResolvedPath)) {
+            TF_CODING_ERROR("Cannot open package-relative paths for write");
+            return false;
+        }
+
+        // If the same resolver handles both assets, give it the chance to
+        // perform the copy itself so it can avoid reading the contents
+        // into memory.
+        ArResolver& resolver = _GetResolver(dstResolvedPath);
+        if (!ArIsPackageRelativePath(srcResolvedPath) &&
+            &_GetResolver(srcResolvedPath) == &resolver) {
+            return resolver.CopyAsset(srcResolvedPath, dstResolvedPath, mode);
+        }
+
+        // Otherwise, stream the contents through this object so that
+        // package-relative source paths and assets handled by different
+        // resolvers are opened with the appropriate resolver.
+        return ArResolver::_CopyAsset(srcResolvedPath, dstResolvedPath, mode);
+    }
+
     // The primary resolver and the package resolvers all participate in
     // scoped caching and may have caching-related data to store away. To
     // accommodate this, _Resolver stores away a vector of VtValues where
@@ -1251,6 +1445,15 @@ private:
                 _packageResolvers.push_back(std::make_shared<_PackageResolver>(
                     extension, plugin, packageResolverType));
 
+                // Package formats are case-insensitive. If multiple
+                // resolvers declare the same format, the first one wins.
+                const std::string& format = _packageFormats.emplace_back(
+                    TfStringToLowerAscii(extension));
+                _packageResolversByFormat.emplace(
+                    format, _packageResolvers.back().get());
+                _maxPackageFormatLength =
+                    std::max(_maxPackageFormatLength, extension.size());
+
                 TF_DEBUG(AR_RESOLVER_INIT).Msg(
                     "ArGetResolver(): Using package resolver %s for %s "
                     "from plugin %s\n", 
@@ -1260,11 +1463,52 @@ private:
         }
     }
 
+    // Resolves \p path with \p resolver, using the current cache scope if
+    // \p resolver doesn't implement its own scoped caches.
+    ArResolvedPath
+    _ResolveWithResolver(
+        ArResolver& resolver,
+        const _ResolverInfo& info,
+        const std::string& path) const
+    {
+        if (!info.implementsScopedCaches) {
+            if (_Cache* currentCache = _threadCache.BorrowCurrentCache()) {
+                _Cache::_PathToResolvedPathMap::accessor accessor;
+                if (currentCache->_pathToResolvedPathMap.insert(
+                        accessor, std::make_pair(path, ArResolvedPath()))) {
+                    accessor->second = _CallResolve(resolver, path);
+                }
+                return accessor->second;
+            }
+        }
+
+        return _CallResolve(resolver, path);
+    }
+
+    // Calls \p resolver's Resolve, skipping the virtual call if it is the
+    // primary ArDefaultResolver.
+    ArResolvedPath
+    _CallResolve(ArResolver& resolver, const std::string& path) const
+    {
+        if (&resolver == _primaryDefaultResolver) {
+            return Ar_ResolveWithDefaultResolver(
+                *_primaryDefaultResolver, path);
+        }
+        return resolver.Resolve(path);
+    }
+
     ArResolver&
     _GetResolver(
         const std::string& assetPath,
         const _ResolverInfo** info = nullptr) const
     {
+        if (_primaryOnlyResolver) {
+            if (info) {
+                *info = &_resolver->info;
+            }
+            return *_primaryOnlyResolver;
+        }
+
         ArResolver* uriResolver = _GetURIResolver(assetPath, info);
         if (uriResolver) {
             return *uriResolver;
@@ -1322,71 +1566,267 @@ private:
         return nullptr;
     }
 
+    // Returns the package resolver for the package at \p packagePath. If
+    // this is a package-relative path, this is the resolver for the format
+    // of the innermost packaged path.
     ArPackageResolver*
-    _GetPackageResolver(const std::string& packageRelativePath) const
+    _GetPackageResolver(const std::string& packagePath) const
     {
-        const std::string innermostPackage = 
-            ArSplitPackageRelativePathInner(packageRelativePath).first;
-        const std::string format = GetExtension(innermostPackage);
+        if (ArIsPackageRelativePath(packagePath)) {
+            return _GetPackageResolverForPackagedPath(packagePath);
+        }
+
+        // The outer package path is in the client's asset system, so its
+        // resolver determines its extension. Since this requires dispatching
+        // to that resolver, remember the result if a cache scope is open.
+        if (_Cache* currentCache = _threadCache.BorrowCurrentCache()) {
+            _Cache::_PackagePathToResolverMap::accessor accessor;
+            if (currentCache->_packagePathToResolverMap.insert(
+                    accessor, std::make_pair(packagePath, nullptr))) {
+                accessor->second = _GetPackageResolverForFormat(
+                    _GetResolver(packagePath).GetExtension(packagePath));
+            }
+            return accessor->second;
+        }
 
-        for (size_t i = 0, e = _packageResolvers.size(); i != e; ++i) {
-            if (_packageResolvers[i]->HandlesFormat(format)) {
-                return _packageResolvers[i]->Get();
+        return _GetPackageResolverForFormat(
+            _GetResolver(packagePath).GetExtension(packagePath));
+    }
+
+    // Returns the package resolver for the format of the innermost packaged
+    // path in \p packagedPath. 
+    ArPackageResolver*
+    _GetPackageResolverForPackagedPath(const std::string& packagedPath) const
+    {
+        // The syntax for packaged paths is defined by Ar, so we determine
+        // their extensions ourselves instead of dispatching to another
+        // resolver.
+        if (!ArIsPackageRelativePath(packagedPath)) {
+            return _GetPackageResolverForFormat(
+                _GetExtensionView(packagedPath));
+        }
+
+        const ArPackageRelativePathSplit split =
+            ArSplitPackageRelativePathInnerView(packagedPath);
+        if (!split.packagedPathIsEscaped) {
+            return _GetPackageResolverForFormat(
+                _GetExtensionView(split.packagedPath));
+        }
+        return _GetPackageResolverForFormat(
+            _GetExtensionView(split.GetPackagedPath()));
+    }
+
+    ArPackageResolver*
+    _GetPackageResolverForFormat(std::string_view format) const
+    {
+        if (format.empty() || format.size() > _maxPackageFormatLength) {
+            return nullptr;
+        }
+
+        // Formats are stored in lower-case, so a format containing
+        // upper-case characters is lower-cased into a stack buffer before
+        // looking it up. Formats longer than any registered format were
+        // rejected above, so the heap is only used if a format longer
+        // than the buffer has been registered.
+        const auto isUpper = [](char c) { return c >= 'A' && c <= 'Z'; };
+        char buffer[32];
+        std::string heapBuffer;
+        if (std::any_of(format.begin(), format.end(), isUpper)) {
+            char* key = buffer;
+            if (format.size() > sizeof(buffer)) {
+                heapBuffer.resize(format.size());
+                key = &heapBuffer[0];
             }
+            for (size_t i = 0; i < format.size(); ++i) {
+                key[i] = isUpper(format[i]) ? format[i] - 'A' + 'a' : format[i];
+            }
+            format = std::string_view(key, format.size());
         }
 
-        return nullptr;
+        const auto it = _packageResolversByFormat.find(format);
+        return it != _packageResolversByFormat.end() ?
+            it->second->Get() : nullptr;
     }
 
+    // Returns the extension of \p path without allocating, following the
+    // same rules as TfGetExtension.
+    static std::string_view
+    _GetExtensionView(std::string_view path)
+    {
+#if defined(ARCH_OS_WINDOWS)
+        constexpr const char* separators = "/\\";
+#else
+        constexpr const char* separators = "/";
+#endif
+        const size_t lastNonSep = path.find_last_not_of(separators);
+        if (lastNonSep == std::string_view::npos) {
+            return std::string_view();
+        }
+        path = path.substr(0, lastNonSep + 1);
+
+        const size_t lastSep = path.find_last_of(separators);
+        if (lastSep != std::string_view::npos) {
+            path.remove_prefix(lastSep + 1);
+        }
+
+        // A leading "." denotes a dot file rather than an extension.
+        const size_t lastDot = path.rfind('.');
+        if (lastDot == std::string_view::npos || lastDot == 0) {
+            return std::string_view();
+        }
+        return path.substr(lastDot + 1);
+    }
+
+    struct _Cache;
+
     template <class ResolveFn>
     ArResolvedPath
     _ResolveHelper(const std::string& path, ResolveFn resolveFn) const
     {
         if (ArIsPackageRelativePath(path)) {
-            // Resolve the outer-most package path first. For example, given a
-            // path like "/path/to/p.package_a[sub.package_b[asset.file]]", the
-            // underlying resolver needs to resolve "/path/to/p.package_a"
-            // since this is a 'real' asset in the client's asset system. 
-            std::string packagePath, packagedPath;
-            std::tie(packagePath, packagedPath) = 
-                ArSplitPackageRelativePathOuter(path);
-
-            std::string resolvedPackagePath = resolveFn(packagePath);
-            if (resolvedPackagePath.empty()) {
+            // Within a cache scope, remember the result for the full
+            // package-relative path so repeated requests for the same path
+            // don't walk through the nested packages again. This is skipped
+            // if the outer package path's resolver implements its own
+            // scoped caches, since its results may depend on state the
+            // dispatcher doesn't know about, like the bound context.
+            _Cache* currentCache = _threadCache.BorrowCurrentCache();
+            if (currentCache &&
+                !_OuterResolverImplementsScopedCaches(path)) {
+                _Cache::_PathToResolvedPathMap::accessor accessor;
+                if (currentCache->_packageRelativePathToResolvedPathMap.insert(
+                        accessor, std::make_pair(path, ArResolvedPath()))) {
+                    accessor->second = _ResolvePackageRelativePath(
+                        path, resolveFn, currentCache);
+                }
+                return accessor->second;
+            }
+
+            return _ResolvePackageRelativePath(path, resolveFn, currentCache);
+        }
+
+        return resolveFn(path);
+    }
+
+    // Returns true if the resolver for the outer package path of the
+    // package-relative path \p path implements its own scoped caches.
+    bool
+    _OuterResolverImplementsScopedCaches(const std::string& path) const
+    {
+        if (_primaryOnlyResolver) {
+            return _resolver->info.implementsScopedCaches;
+        }
+
+        const _ResolverInfo* info = nullptr;
+        _GetResolver(
+            ArSplitPackageRelativePathOuterView(path).GetPackagePath(), &info);
+        return info->implementsScopedCaches;
+    }
+
+    template <class ResolveFn>
+    ArResolvedPath
+    _ResolvePackageRelativePath(
+        const std::string& path, ResolveFn resolveFn, _Cache* cache) const
+    {
+        // Parse the path once up front so that walking through nested
+        // packages below does not need to split the path again at
+        // every level.
+        const ArPackageRelativePath packageRelativePath(path);
+        const std::vector<std::string>& segments =
+            packageRelativePath.GetSegments();
+
+        // Resolve the outer-most package path first. For example, given a
+        // path like "/path/to/p.package_a[sub.package_b[asset.file]]", the
+        // underlying resolver needs to resolve "/path/to/p.package_a"
+        // since this is a 'real' asset in the client's asset system. 
+        std::string resolvedPackagePath = resolveFn(segments.front());
+        if (resolvedPackagePath.empty()) {
+            return ArResolvedPath();
+        }
+
+        // Loop through the remaining packaged paths and resolve each
+        // of them using the appropriate package resolver. In the above
+        // example, this loop would:
+        //
+        //   - Resolve "sub.package_b" in package "/path/to/p.package_a"
+        //   - Resolve "asset.file" in "/path/to/p.package_a[sub.package_b]"
+        //
+        ArPackageResolver* packageResolver =
+            _GetPackageResolver(resolvedPackagePath);
+        for (size_t i = 1, e = segments.size(); i != e; ++i) {
+            if (!packageResolver) {
                 return ArResolvedPath();
             }
 
-            // Loop through the remaining packaged paths and resolve each
-            // of them using the appropriate package resolver. In the above
-            // example, this loop would:
-            //
-            //   - Resolve "sub.package_b" in package "/path/to/p.package_a"
-            //   - Resolve "asset.file" in "/path/to/p.package_a[sub.package_b]"
-            //
-            while (!packagedPath.empty()) {
-                std::tie(packagePath, packagedPath) = 
-                    ArSplitPackageRelativePathOuter(packagedPath);
-                
-                ArPackageResolver* packageResolver =
-                    _GetPackageResolver(resolvedPackagePath);
-                if (!packageResolver) {
-                    return ArResolvedPath();
-                }
+            _PackagedPathResolution resolution = _ResolvePackagedPath(
+                packageResolver, resolvedPackagePath, segments[i], cache);
+            if (resolution.packagedPath.empty()) {
+                return ArResolvedPath();
+            }
 
-                packagePath = packageResolver->Resolve(
-                    resolvedPackagePath, packagePath);
-                if (packagePath.empty()) {
-                    return ArResolvedPath();
-                }
+            if (i + 1 != e) {
+                packageResolver =
+                    _GetPackageResolverForPackagedPath(resolution.packagedPath);
+            }
+
+            resolvedPackagePath = std::move(resolution.resolvedPath);
+        }
+
+        return ArResolvedPath(std::move(resolvedPackagePath));
+    }
+
+    // Result of resolving a packaged path in a package.
+    struct _PackagedPathResolution
+    {
+        // The resolved packaged path returned by the package resolver, or
+        // empty if the packaged path could not be resolved.
+        std::string packagedPath;
 
-                resolvedPackagePath = ArJoinPackageRelativePath(
-                    resolvedPackagePath, packagePath);
+        // The package-relative path joining the resolved package path with
+        // the resolved packaged path.
+        std::string resolvedPath;
+    };
+
+    // Resolves \p packagedPath in the package at \p resolvedPackagePath
+    // using \p packageResolver. If \p cache is given, the result is
+    // remembered there so other paths into the same package can reuse it.
+    _PackagedPathResolution
+    _ResolvePackagedPath(
+        ArPackageResolver* packageResolver,
+        const std::string& resolvedPackagePath,
+        const std::string& packagedPath,
+        _Cache* cache) const
+    {
+        auto resolve = [&]() {
+            _PackagedPathResolution resolution;
+            resolution.packagedPath = packageResolver->Resolve(
+                resolvedPackagePath, packagedPath);
+            if (!resolution.packagedPath.empty()) {
+                resolution.resolvedPath = ArJoinPackageRelativePath(
+                    resolvedPackagePath, resolution.packagedPath);
             }
+            return resolution;
+        };
 
-            return ArResolvedPath(std::move(resolvedPackagePath));
+        if (!cache) {
+            return resolve();
         }
 
-        return resolveFn(path);
+        // Paths can't contain NUL characters, so using one as a separator
+        // gives each (package, packaged path) pair a unique key.
+        std::string key;
+        key.reserve(resolvedPackagePath.size() + packagedPath.size() + 1);
+        key.append(resolvedPackagePath);
+        key.push_back('\0');
+        key.append(packagedPath);
+
+        _Cache::_PackagedPathResolutionMap::accessor accessor;
+        if (cache->_packagedPathResolutionMap.insert(
+                accessor, std::make_pair(std::move(key),
+                                         _PackagedPathResolution()))) {
+            accessor->second = resolve();
+        }
+        return accessor->second;
     }
 
     // Primary and URI/IRI Resolvers --------------------
@@ -1417,6 +1857,14 @@ private:
     std::unordered_map<std::string, _ResolverSharedPtr> _uriResolvers;
     size_t _maxURISchemeLength;
 
+    // The primary resolver if there are no URI/IRI resolvers, null
+    // otherwise.
+    ArResolver* _primaryOnlyResolver = nullptr;
+
+    // The primary resolver if it is exactly an ArDefaultResolver, null
+    // otherwise.
+    ArDefaultResolver* _primaryDefaultResolver = nullptr;
+
     // Package Resolvers --------------------
 
     class _PackageResolver
@@ -1435,9 +1883,9 @@ private:
             , _packageFormat(packageFormat)
         { }
 
-        bool HandlesFormat(const std::string& extension) const
+        const std::string& GetFormat() const
         {
-            return _packageFormat == extension;
+            return _packageFormat;
         }
 
     private:
@@ -1447,11 +1895,34 @@ private:
     using _PackageResolverSharedPtr = std::shared_ptr<_PackageResolver>;
     std::vector<_PackageResolverSharedPtr> _packageResolvers;
 
+    // Package resolvers indexed by their lower-case package format. The
+    // keys refer to the strings in _packageFormats.
+    std::deque<std::string> _packageFormats;
+    std::unordered_map<std::string_view, _PackageResolver*> 
+        _packageResolversByFormat;
+    size_t _maxPackageFormatLength = 0;
+
     // Context Management --------------------
 
-    using _ContextStack = std::vector<const ArResolverContext*>;
-    using _PerThreadContextStack = 
-        tbb::enumerable_thread_specific<_ContextStack>;
+    struct _ContextBinding
+    {
+        ArResolverContext context;
+
+        // Binding data for the primary resolver and each URI/IRI resolver.
+        std::vector<VtValue> resolverData;
+    };
+
+    // Stack of contexts bound in a thread. Only the first size entries in
+    // bindings are in use; the remaining entries are kept for reuse. A
+    // deque is used so that entries aren't moved when the stack grows
+    // while a resolver is binding a context.
+    struct _ContextStack
+    {
+        std::deque<_ContextBinding> bindings;
+        size_t size = 0;
+    };
+
+    using _PerThreadContextStack = Ar_ThreadSpecific<_ContextStack>;
     mutable _PerThreadContextStack _threadContextStack;
 
     // Scoped Cache --------------------
@@ -1461,10 +1932,21 @@ private:
         using _PathToResolvedPathMap = 
             tbb::concurrent_hash_map<std::string, ArResolvedPath>;
         _PathToResolvedPathMap _pathToResolvedPathMap;
+
+        using _PackagePathToResolverMap = 
+            tbb::concurrent_hash_map<std::string, ArPackageResolver*>;
+        _PackagePathToResolverMap _packagePathToResolverMap;
+
+        // Results for package-relative paths and for each packaged path
+        // resolved in a package while computing those results.
+        _PathToResolvedPathMap _packageRelativePathToResolvedPathMap;
+
+        using _PackagedPathResolutionMap = tbb::concurrent_hash_map<
+            std::string, _PackagedPathResolution>;
+        _PackagedPathResolutionMap _packagedPathResolutionMap;
     };
 
     using _PerThreadCache = ArThreadLocalScopedCache<_Cache>;
-    using _CachePtr = _PerThreadCache::CachePtr;
     mutable _PerThreadCache _threadCache;
 
 };
@@ -1615,6 +2097,13 @@ ArResolver::OpenAsset(
     return _OpenAsset(resolvedPath);
 }
 
+std::vector<std::shared_ptr<ArAsset>>
+ArResolver::OpenAssets(
+    const std::vector<ArResolvedPath>& resolvedPaths) const
+{
+    return _OpenAssets(resolvedPaths);
+}
+
 std::shared_ptr<ArWritableAsset>
 ArResolver::OpenAssetForWrite(
     const ArResolvedPath& resolvedPath,
@@ -1631,6 +2120,15 @@ ArResolver::CanWriteAssetToPath(
     return _CanWriteAssetToPath(resolvedPath, whyNot);
 }
 
+bool
+ArResolver::CopyAsset(
+    const ArResolvedPath& srcResolvedPath,
+    const ArResolvedPath& dstResolvedPath,
+    WriteMode writeMode) const
+{
+    return _CopyAsset(srcResolvedPath, dstResolvedPath, writeMode);
+}
+
 bool
 ArResolver::IsContextDependentPath(
     const std::string& assetPath) const
@@ -1748,6 +2246,65 @@ ArResolver::_CanWriteAssetToPath(
     return true;
 }
 
+std::vector<std::shared_ptr<ArAsset>>
+ArResolver::_OpenAssets(
+    const std::vector<ArResolvedPath>& resolvedPaths) const
+{
+    std::vector<std::shared_ptr<ArAsset>> assets;
+    assets.reserve(resolvedPaths.size());
+    for (const ArResolvedPath& resolvedPath : resolvedPaths) {
+        assets.push_back(_OpenAsset(resolvedPath));
+    }
+    return assets;
+}
+
+bool
+ArResolver::_CopyAsset(
+    const ArResolvedPath& srcResolvedPath,
+    const ArResolvedPath& dstResolvedPath,
+    WriteMode writeMode) const
+{
+    const std::shared_ptr<ArAsset> srcAsset = OpenAsset(srcResolvedPath);
+    if (!srcAsset) {
+        TF_RUNTIME_ERROR(
+            "Could not open asset '%s' for copy",
+            srcResolvedPath.GetPathString().c_str());
+        return false;
+    }
+
+    const std::shared_ptr<ArWritableAsset> dstAsset =
+        OpenAssetForWrite(dstResolvedPath, writeMode);
+    if (!dstAsset) {
+        TF_RUNTIME_ERROR(
+            "Could not open asset '%s' for write",
+            dstResolvedPath.GetPathString().c_str());
+        return false;
+    }
+
+    const size_t assetSize = srcAsset->GetSize();
+    dstAsset->Reserve(assetSize);
+
+    // Stream the contents in large chunks to bound memory usage for large
+    // assets while keeping the number of Read and Write calls low.
+    constexpr size_t maxChunkSize = 8 * 1024 * 1024;
+    const size_t chunkSize = std::min(assetSize, maxChunkSize);
+    std::unique_ptr<char[]> chunk(new char[chunkSize]);
+
+    for (size_t offset = 0; offset < assetSize; offset += chunkSize) {
+        const size_t count = std::min(chunkSize, assetSize - offset);
+        if (srcAsset->Read(chunk.get(), count, offset) != count ||
+            dstAsset->Write(chunk.get(), count, offset) != count) {
+            TF_RUNTIME_ERROR(
+                "Failed to copy asset '%s' to '%s'",
+                srcResolvedPath.GetPathString().c_str(),
+                dstResolvedPath.GetPathString().c_str());
+            return false;
+        }
+    }
+
+    return dstAsset->Close();
+}
+
 bool
 ArResolver::_IsContextDependentPath(
     const std::string& assetPath) const
@@ -1768,6 +2325,12 @@ ArResolver::_GetInternallyManagedCurrentContext() const
     return _GetResolver().GetInternallyManagedCurrentContext();
 }
 
+bool
+Ar_IsCacheScopeActive()
+{
+    return _GetResolver().IsCacheScopeActive();
+}
+
 // ------------------------------------------------------------
 
 ArResolver& 
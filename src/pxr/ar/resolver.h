@@ -260,6 +260,13 @@ public:
 
     /// Returns the file extension for the given \p assetPath. The returned
     /// extension does not include a "." at the beginning.
+    ///
+    /// If \p assetPath is a package-relative path, this returns the
+    /// extension of the innermost packaged path. Ar defines the syntax for
+    /// packaged paths, so this extension is computed by Ar rather than the
+    /// resolver for the outer package, and is the extension used to select
+    /// the package resolver for that packaged path. Package resolvers are
+    /// selected without regard to the case of the extension.
     AR_API
     std::string GetExtension(
         const std::string& assetPath) const;
@@ -290,6 +297,19 @@ public:
     std::shared_ptr<ArAsset> OpenAsset(
         const ArResolvedPath& resolvedPath) const;
 
+    /// Returns ArAsset objects for the assets located at each path in
+    /// \p resolvedPaths, in the same order. The result for any asset that
+    /// could not be opened is an invalid std::shared_ptr.
+    ///
+    /// This is equivalent to calling OpenAsset for each path, but allows
+    /// implementations to open many assets more efficiently. For example,
+    /// assets in the same package are opened with a single call to
+    /// ArPackageResolver::OpenAssets, which may read all of them from the
+    /// package in one pass.
+    AR_API
+    std::vector<std::shared_ptr<ArAsset>> OpenAssets(
+        const std::vector<ArResolvedPath>& resolvedPaths) const;
+
     /// Enumeration of write modes for OpenAssetForWrite
     enum class WriteMode
     {
@@ -328,6 +348,25 @@ public:
         const ArResolvedPath& resolvedPath,
         std::string* whyNot = nullptr) const;
 
+    /// Copies the contents of the asset located at \p srcResolvedPath to
+    /// the asset located at \p dstResolvedPath using the specified
+    /// \p writeMode. Returns true on success, false otherwise.
+    ///
+    /// This is equivalent to opening \p srcResolvedPath with OpenAsset,
+    /// opening \p dstResolvedPath with OpenAssetForWrite and transferring
+    /// the contents between the two, but allows implementations to avoid
+    /// moving data through user space, e.g. by using filesystem-level
+    /// copies or copies performed by a remote asset server.
+    ///
+    /// \p srcResolvedPath may be a package-relative path, but
+    /// \p dstResolvedPath may not since package-relative paths cannot be
+    /// opened for write.
+    AR_API
+    bool CopyAsset(
+        const ArResolvedPath& srcResolvedPath,
+        const ArResolvedPath& dstResolvedPath,
+        WriteMode writeMode) const;
+
     /// @}
 
     // --------------------------------------------------------------------- //
@@ -712,6 +751,15 @@ protected:
     virtual std::shared_ptr<ArAsset> _OpenAsset(
         const ArResolvedPath& resolvedPath) const = 0;
 
+    /// Return ArAsset objects for the assets located at each path in
+    /// \p resolvedPaths, in the same order, with an invalid
+    /// std::shared_ptr for any asset that could not be opened.
+    ///
+    /// The default implementation calls _OpenAsset for each path.
+    AR_API
+    virtual std::vector<std::shared_ptr<ArAsset>> _OpenAssets(
+        const std::vector<ArResolvedPath>& resolvedPaths) const;
+
     /// Return true if an asset may be written to the given \p resolvedPath,
     /// false otherwise. If this function returns false and \p whyNot is not
     /// \c nullptr, it may be filled with an explanation.  The default
@@ -736,6 +784,25 @@ protected:
         const ArResolvedPath& resolvedPath,
         WriteMode writeMode) const = 0;
 
+    /// Copy the contents of the asset at \p srcResolvedPath to the asset
+    /// at \p dstResolvedPath using the specified \p writeMode. Return true
+    /// on success, false otherwise.
+    ///
+    /// Implementations may override this to perform copies without reading
+    /// the asset's contents into memory, for example by cloning files on
+    /// the filesystem or issuing a copy request to a remote asset server.
+    /// The destination asset must obey the behaviors for the given
+    /// \p writeMode in the same way as _OpenAssetForWrite.
+    ///
+    /// The default implementation opens \p srcResolvedPath with OpenAsset
+    /// and \p dstResolvedPath with OpenAssetForWrite and streams the
+    /// contents between them in large chunks.
+    AR_API
+    virtual bool _CopyAsset(
+        const ArResolvedPath& srcResolvedPath,
+        const ArResolvedPath& dstResolvedPath,
+        WriteMode writeMode) const;
+
     /// @}
 
     // --------------------------------------------------------------------- //
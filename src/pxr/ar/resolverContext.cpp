@@ -6,65 +6,155 @@
 // Modified by Jeremy Retailleau.
 
 #include "./resolverContext.h"
+#include "./internTable.h"
 #include <pxr/arch/demangle.h>
 #include <pxr/tf/diagnosticLite.h>
 #include <pxr/tf/stringUtils.h>
 
 #include <functional>
+#include <mutex>
 #include <typeindex>
+#include <unordered_map>
+#include <utility>
 
 namespace pxr {
 
 ArResolverContext::_Untyped::~_Untyped() { }
 
+namespace
+{
+
+template <class Contexts>
+bool
+_ContextsEqual(const Contexts& lhs, const Contexts& rhs)
+{
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        const auto& lhsContext = lhs[i];
+        const auto& rhsContext = rhs[i];
+        if (lhsContext == rhsContext) {
+            continue;
+        }
+        if (!lhsContext->IsHolding(rhsContext->GetTypeid()) ||
+            !lhsContext->Equals(*rhsContext)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // end anonymous namespace
+
 ArResolverContext::ArResolverContext(
     const std::vector<ArResolverContext>& ctxs)
 {
+    if (ctxs.size() == 1) {
+        _data = ctxs.front()._data;
+        return;
+    }
+
+    _Contexts contexts;
     for (const ArResolverContext& ctx : ctxs) {
-        _Add(ctx);
+        _Add(&contexts, ctx);
     }
+    _Intern(std::move(contexts));
 }
 
 void
-ArResolverContext::_Add(const ArResolverContext& ctx)
+ArResolverContext::_Add(_Contexts* contexts, const ArResolverContext& ctx)
 {
-    for (const auto& obj : ctx._contexts) {
-        _Add(std::shared_ptr<_Untyped>(obj->Clone()));
+    if (!ctx._data) {
+        return;
+    }
+
+    // Context objects are immutable, so they can be shared with the
+    // given context instead of being copied.
+    for (const auto& obj : ctx._data->contexts) {
+        _Add(contexts, std::shared_ptr<const _Untyped>(obj));
     }
 }
 
-bool
-ArResolverContext::operator==(const ArResolverContext& rhs) const
+void
+ArResolverContext::_Add(
+    _Contexts* contexts, std::shared_ptr<const _Untyped>&& context)
 {
-    if (_contexts.size() != rhs._contexts.size()) {
-        return false;
+    auto insertIt = std::lower_bound(
+        contexts->begin(), contexts->end(), context,
+        [](const std::shared_ptr<const _Untyped>& a,
+           const std::shared_ptr<const _Untyped>& b) {
+            return std::type_index(a->GetTypeid()) < 
+                   std::type_index(b->GetTypeid());
+        });
+
+    if (insertIt != contexts->end() && 
+        (*insertIt)->IsHolding(context->GetTypeid())) {
+        return;
     }
-    
-    for (size_t i = 0; i < _contexts.size(); ++i) {
-        const auto& lhsContext = _contexts[i];
-        const auto& rhsContext = rhs._contexts[i];
-        if (!lhsContext->IsHolding(rhsContext->GetTypeid()) ||
-            !lhsContext->Equals(*rhsContext)) {
-            return false;
-        }
+
+    contexts->insert(insertIt, std::move(context));
+}
+
+void
+ArResolverContext::_Intern(_Contexts&& contexts)
+{
+    if (contexts.empty()) {
+        _data.reset();
+        return;
     }
-    
-    return true;
+
+    size_t hash = 0;
+    for (const auto& context : contexts) {
+        hash = TfHash::Combine(hash, context->Hash());
+    }
+
+    _data = Ar_InternTable<_Data>::GetInstance().Intern(
+        hash,
+        [&contexts](const _Data& data) {
+            return _ContextsEqual(data.contexts, contexts);
+        },
+        [&contexts, hash]() {
+            std::unique_ptr<_Data> data(new _Data);
+            data->contexts = std::move(contexts);
+            data->hash = hash;
+            for (const auto& context : data->contexts) {
+                const size_t index = context->GetTypeIndex();
+                if (index >= data->contextsByTypeIndex.size()) {
+                    data->contextsByTypeIndex.resize(index + 1, nullptr);
+                }
+                data->contextsByTypeIndex[index] = context.get();
+            }
+            return data;
+        });
 }
 
 bool
 ArResolverContext::operator<(const ArResolverContext& rhs) const
 {
-    if (_contexts.size() < rhs._contexts.size()) {
+    if (_data == rhs._data) {
+        return false;
+    }
+
+    static const _Contexts empty;
+    const _Contexts& lhsContexts = _data ? _data->contexts : empty;
+    const _Contexts& rhsContexts = rhs._data ? rhs._data->contexts : empty;
+
+    if (lhsContexts.size() < rhsContexts.size()) {
         return true;
     }
-    else if (_contexts.size() > rhs._contexts.size()) {
+    else if (lhsContexts.size() > rhsContexts.size()) {
         return false;
     }
 
-    for (size_t i = 0; i < _contexts.size(); ++i) {
-        const auto& lhsContext = _contexts[i];
-        const auto& rhsContext = rhs._contexts[i];
+    for (size_t i = 0; i < lhsContexts.size(); ++i) {
+        const auto& lhsContext = lhsContexts[i];
+        const auto& rhsContext = rhsContexts[i];
+        if (lhsContext == rhsContext) {
+            continue;
+        }
         if (lhsContext->IsHolding(rhsContext->GetTypeid())) {
             if (lhsContext->LessThan(*rhsContext)) {
                 return true;
@@ -82,36 +172,32 @@ ArResolverContext::operator<(const ArResolverContext& rhs) const
     return false;
 }
 
-void
-ArResolverContext::_Add(std::shared_ptr<_Untyped>&& context)
-{
-    auto insertIt = std::lower_bound(
-        _contexts.begin(), _contexts.end(), context,
-        [](const std::shared_ptr<_Untyped>& a,
-           const std::shared_ptr<_Untyped>& b) {
-            return std::type_index(a->GetTypeid()) < 
-                   std::type_index(b->GetTypeid());
-        });
-
-    if (insertIt != _contexts.end() && 
-        (*insertIt)->IsHolding(context->GetTypeid())) {
-        return;
-    }
-
-    _contexts.insert(insertIt, std::move(context));
-}
-
 std::string
 ArResolverContext::GetDebugString() const
 {
     std::string s;
-    for (const auto& context : _contexts) {
+    if (!_data) {
+        return s;
+    }
+    for (const auto& context : _data->contexts) {
         s += context->GetDebugString();
         s += "\n";
     }
     return s;
 }
 
+size_t
+Ar_GetContextObjectTypeIndex(const std::type_info& ti)
+{
+    // Types are keyed by name since the same type may have distinct
+    // type_info objects in different shared libraries.
+    static std::mutex mutex;
+    static auto& indexes = *new std::unordered_map<std::string, size_t>;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return indexes.emplace(ti.name(), indexes.size()).first->second;
+}
+
 std::string
 Ar_GetDebugString(const std::type_info& info, void const* context) 
 {
@@ -49,6 +49,21 @@ struct ArIsContextObject
 template <class Context> 
 std::string ArGetDebugString(const Context& context); 
 
+// Returns the index assigned to the context object type \p ti. Indexes
+// are small integers assigned in the order types are first seen, and
+// types with the same name in different shared libraries share an index.
+AR_API
+size_t Ar_GetContextObjectTypeIndex(const std::type_info& ti);
+
+// Returns the index for the context object type \p Context. This is
+// computed once per type.
+template <class Context>
+size_t Ar_GetContextObjectTypeIndex()
+{
+    static const size_t index = Ar_GetContextObjectTypeIndex(typeid(Context));
+    return index;
+}
+
 // Metafunctions for determining if a variadic list of objects
 // are valid for use with the ArResolverContext c'tor.
 class ArResolverContext;
@@ -100,6 +115,14 @@ struct Ar_AllValidForContext<>
 /// The AR_DECLARE_RESOLVER_CONTEXT macro can be used to do this
 /// as a convenience.
 /// 
+/// ArResolverContext objects are immutable and interned: context objects
+/// are shared rather than copied when contexts are combined, and all
+/// ArResolverContext objects holding equal context objects share the same
+/// storage. This makes copying, hashing and equality comparisons cheap,
+/// which is useful since contexts are frequently used as keys in maps.
+/// Consequently, a context object's hash_value must be consistent with its
+/// operator==.
+///
 /// \sa AR_DECLARE_RESOLVER_CONTEXT
 /// \sa ArResolver::BindContext
 /// \sa ArResolver::UnbindContext
@@ -133,7 +156,9 @@ public:
             = nullptr>
     ArResolverContext(const Objects&... objs)
     {
-        _AddObjects(objs...);
+        _Contexts contexts;
+        _AddObjects(&contexts, objs...);
+        _Intern(std::move(contexts));
     }
 
     /// Construct a resolver context using the ArResolverContexts in \p ctxs.
@@ -151,7 +176,7 @@ public:
     /// Returns whether this resolver context is empty.
     bool IsEmpty() const
     {
-        return _contexts.empty();
+        return !_data;
     }
 
     /// Returns pointer to the context object of the given type
@@ -160,12 +185,17 @@ public:
     template <class ContextObj>
     const ContextObj* Get() const
     {
-        for (const auto& context : _contexts) {
-            if (context->IsHolding(typeid(ContextObj))) {
-                return &_GetTyped<ContextObj>(*context)._context;
-            }
+        if (!_data) {
+            return nullptr;
+        }
+
+        const size_t index = Ar_GetContextObjectTypeIndex<ContextObj>();
+        if (index >= _data->contextsByTypeIndex.size()) {
+            return nullptr;
         }
-        return nullptr;
+
+        const _Untyped* context = _data->contextsByTypeIndex[index];
+        return context ? &_GetTyped<ContextObj>(*context)._context : nullptr;
     }
 
     /// Returns a debug string representing the contained context objects.
@@ -174,8 +204,11 @@ public:
 
     /// \name Operators
     /// @{
-    AR_API
-    bool operator==(const ArResolverContext& rhs) const;
+    bool operator==(const ArResolverContext& rhs) const
+    {
+        // Equal contexts always share the same interned storage.
+        return _data == rhs._data;
+    }
 
     bool operator!=(const ArResolverContext& rhs) const
     {
@@ -190,7 +223,7 @@ public:
     /// Returns hash value for this asset resolver context.
     friend size_t hash_value(const ArResolverContext& context)
     {
-        return TfHash()(context._contexts);
+        return context._data ? context._data->hash : 0;
     }
 
 private:
@@ -198,29 +231,43 @@ private:
     struct _Untyped;
     template <class Context> struct _Typed;
 
-    void _AddObjects()
+    // Context objects sorted by type. These are never modified once they
+    // have been added to a context, so they may be shared between contexts.
+    using _Contexts = std::vector<std::shared_ptr<const _Untyped>>;
+
+    // Interned storage shared by all equal contexts.
+    struct _Data;
+
+    void _AddObjects(_Contexts*)
     {
         // Empty base case for unpacking parameter pack
     }
 
     template <class Object, class ...Other>
-    void _AddObjects(const Object& obj, const Other&... other)
+    void _AddObjects(
+        _Contexts* contexts, const Object& obj, const Other&... other)
     {
-        _Add(obj);
-        _AddObjects(other...);
+        _Add(contexts, obj);
+        _AddObjects(contexts, other...);
     }
 
     AR_API
-    void _Add(const ArResolverContext& ctx);
+    static void _Add(_Contexts* contexts, const ArResolverContext& ctx);
 
     template <class Object>
-    void _Add(const Object& obj)
+    static void _Add(_Contexts* contexts, const Object& obj)
     {
-        _Add(std::shared_ptr<_Untyped>(new _Typed<Object>(obj)));
+        _Add(contexts, std::shared_ptr<const _Untyped>(
+            std::make_shared<const _Typed<Object>>(obj)));
     }
 
     AR_API
-    void _Add(std::shared_ptr<_Untyped>&& context);
+    static void _Add(
+        _Contexts* contexts, std::shared_ptr<const _Untyped>&& context);
+
+    // Sets this object's storage to the interned storage for \p contexts.
+    AR_API
+    void _Intern(_Contexts&& contexts);
 
     template <class Context> 
     static const _Typed<Context>& _GetTyped(const _Untyped& untyped)
@@ -238,8 +285,8 @@ private:
             return TfSafeTypeCompare(ti, GetTypeid());
         }
 
-        virtual _Untyped* Clone() const = 0;
         virtual const std::type_info& GetTypeid() const = 0;
+        virtual size_t GetTypeIndex() const = 0;
         virtual bool LessThan(const _Untyped& rhs) const = 0;
         virtual bool Equals(const _Untyped& rhs) const = 0;
         virtual size_t Hash() const = 0;
@@ -256,14 +303,14 @@ private:
         { 
         }
 
-        virtual _Untyped* Clone() const
+        virtual const std::type_info& GetTypeid() const
         {
-            return new _Typed<Context>(_context);
+            return typeid(Context);
         }
 
-        virtual const std::type_info& GetTypeid() const
+        virtual size_t GetTypeIndex() const
         {
-            return typeid(Context);
+            return Ar_GetContextObjectTypeIndex<Context>();
         }
 
         virtual bool LessThan(const _Untyped& rhs) const
@@ -299,18 +346,21 @@ private:
         Context _context;
     };
 
-    template <class HashState>
-    friend void TfHashAppend(
-        HashState& h, const std::shared_ptr<_Untyped>& context)
+    struct _Data
     {
-        h.Append(context->Hash());
-    }
+        _Contexts contexts;
+        size_t hash;
+
+        // Context objects indexed by Ar_GetContextObjectTypeIndex, or
+        // null for types not held in this context.
+        std::vector<const _Untyped*> contextsByTypeIndex;
+    };
 
 #ifdef PXR_PYTHON_SUPPORT_ENABLED
     friend class Ar_ResolverContextPythonAccess;
 #endif
 
-    std::vector<std::shared_ptr<_Untyped>> _contexts;
+    std::shared_ptr<const _Data> _data;
 };
 
 
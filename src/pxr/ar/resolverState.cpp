@@ -0,0 +1,50 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include "./resolverState.h"
+#include "./cacheScopeUtils.h"
+#include "./resolver.h"
+
+namespace pxr {
+
+ArResolverState
+ArCaptureResolverState()
+{
+    ArResolver& resolver = ArGetResolver();
+
+    ArResolverState state;
+    state._context = resolver.GetCurrentContext();
+
+    // Opening a nested cache scope fills in data that refers to the
+    // current scope's caches. Closing it again leaves the current scope
+    // untouched while the data keeps those caches alive for other threads.
+    if (Ar_IsCacheScopeActive()) {
+        resolver.BeginCacheScope(&state._cacheScopeData);
+        resolver.EndCacheScope(&state._cacheScopeData);
+    }
+
+    return state;
+}
+
+ArResolverStateScope::ArResolverStateScope(const ArResolverState& state)
+    : _cacheScopeData(state._cacheScopeData)
+{
+    if (!_cacheScopeData.IsEmpty()) {
+        ArGetResolver().BeginCacheScope(&_cacheScopeData);
+    }
+    if (!state._context.IsEmpty()) {
+        _binder.emplace(state._context);
+    }
+}
+
+ArResolverStateScope::~ArResolverStateScope()
+{
+    _binder.reset();
+    if (!_cacheScopeData.IsEmpty()) {
+        ArGetResolver().EndCacheScope(&_cacheScopeData);
+    }
+}
+
+}  // namespace pxr
@@ -0,0 +1,149 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#ifndef PXR_AR_RESOLVER_STATE_H
+#define PXR_AR_RESOLVER_STATE_H
+
+/// \file ar/resolverState.h
+
+#include "./api.h"
+#include "./resolverContext.h"
+#include "./resolverContextBinder.h"
+
+#include <pxr/vt/value.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <iterator>
+#include <optional>
+
+namespace pxr {
+
+class ArResolverState;
+
+/// Returns a snapshot of the asset resolver state in the calling thread.
+///
+/// The caches for the current cache scope, if any, are kept alive by the
+/// returned object.
+AR_API
+ArResolverState ArCaptureResolverState();
+
+/// \class ArResolverState
+///
+/// Snapshot of the asset resolver state in a thread, consisting of the
+/// currently bound context and the resolver's current cache scope, if
+/// any.
+///
+/// Contexts bound with ArResolverContextBinder and cache scopes opened
+/// with ArResolverScopedCache only apply to the thread they were created
+/// in. A snapshot taken with ArCaptureResolverState can be reinstalled in
+/// other threads with ArResolverStateScope so that work done in those
+/// threads resolves assets under the same context and shares the same
+/// resolution caches.
+///
+/// \see ArParallelForEach
+class ArResolverState
+{
+public:
+    /// Constructs an empty state with no bound context and no cache scope.
+    ArResolverState() = default;
+
+    /// Returns the context that was bound when this state was captured.
+    const ArResolverContext& GetContext() const
+    {
+        return _context;
+    }
+
+    /// Returns true if a cache scope was open when this state was captured.
+    bool HasCacheScope() const
+    {
+        return !_cacheScopeData.IsEmpty();
+    }
+
+private:
+    friend class ArResolverStateScope;
+    friend ArResolverState ArCaptureResolverState();
+
+    ArResolverContext _context;
+    VtValue _cacheScopeData;
+};
+
+/// \class ArResolverStateScope
+///
+/// Helper object that installs an ArResolverState in the current thread
+/// for its lifetime.
+///
+/// The state's context is bound as if by ArResolverContextBinder, and if
+/// the state has a cache scope, a cache scope sharing its caches is opened
+/// as if by ArResolverScopedCache.
+class ArResolverStateScope
+{
+public:
+    ArResolverStateScope(const ArResolverStateScope&) = delete;
+    ArResolverStateScope& operator=(const ArResolverStateScope&) = delete;
+
+    /// Installs the given \p state in the current thread.
+    AR_API
+    explicit ArResolverStateScope(const ArResolverState& state);
+
+    /// Unbinds the state's context and closes its cache scope.
+    AR_API
+    ~ArResolverStateScope();
+
+private:
+    VtValue _cacheScopeData;
+    std::optional<ArResolverContextBinder> _binder;
+};
+
+/// Invokes \p fn on each element in the range [\p begin, \p end) in
+/// parallel, with the calling thread's resolver state installed in every
+/// thread doing the work.
+///
+/// \p begin and \p end must be random access iterators.
+///
+/// \see ArResolverState
+template <class Iterator, class Fn>
+void
+ArParallelForEach(Iterator begin, Iterator end, const Fn& fn)
+{
+    using _Difference =
+        typename std::iterator_traits<Iterator>::difference_type;
+
+    const _Difference size = std::distance(begin, end);
+    if (size <= 0) {
+        return;
+    }
+
+    const ArResolverState state = ArCaptureResolverState();
+    tbb::parallel_for(
+        tbb::blocked_range<_Difference>(0, size),
+        [&state, &begin, &fn](const tbb::blocked_range<_Difference>& range) {
+            // Install the state once per chunk of work rather than once
+            // per element.
+            ArResolverStateScope scope(state);
+            for (_Difference i = range.begin(); i != range.end(); ++i) {
+                fn(*(begin + i));
+            }
+        });
+}
+
+/// Invokes \p fn on each element in \p range in parallel, with the
+/// calling thread's resolver state installed in every thread doing the
+/// work.
+///
+/// \p range must provide random access iterators.
+template <class Range, class Fn>
+void
+ArParallelForEach(Range&& range, const Fn& fn)
+{
+    using std::begin;
+    using std::end;
+    ArParallelForEach(begin(range), end(range), fn);
+}
+
+}  // namespace pxr
+
+#endif // PXR_AR_RESOLVER_STATE_H
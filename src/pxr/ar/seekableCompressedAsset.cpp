@@ -0,0 +1,336 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include "./seekableCompressedAsset.h"
+
+#include <pxr/tf/diagnostic.h>
+#include <pxr/tf/envSetting.h>
+#include <pxr/tf/stringUtils.h>
+
+#if defined(AR_WITH_ZSTD)
+#include <zstd.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <set>
+
+namespace pxr {
+
+TF_DEFINE_ENV_SETTING(
+    PXR_AR_SEEKABLE_COMPRESSED_EXTENSIONS, "",
+    "Comma-separated list of file extensions for assets stored in the zstd "
+    "seekable format that ArDefaultResolver should decompress when opened.");
+
+namespace
+{
+
+// The seek table is stored in a skippable frame at the end of the asset,
+// followed by a footer identifying the seekable format.
+constexpr uint32_t _SkippableFrameMagic = 0x184D2A5E;
+constexpr uint32_t _SeekableMagic = 0x8F92EAB1;
+
+constexpr size_t _SkippableFrameHeaderSize = 8;
+constexpr size_t _SeekTableFooterSize = 9;
+constexpr size_t _SeekTableEntrySize = 8;
+constexpr size_t _SeekTableChecksumSize = 4;
+
+constexpr uint8_t _ChecksumFlag = 0x80;
+
+uint32_t
+_ReadU32(const char* p)
+{
+    const unsigned char* b = reinterpret_cast<const unsigned char*>(p);
+    return uint32_t(b[0]) | uint32_t(b[1]) << 8 |
+        uint32_t(b[2]) << 16 | uint32_t(b[3]) << 24;
+}
+
+} // end anonymous namespace
+
+std::shared_ptr<ArSeekableCompressedAsset>
+ArSeekableCompressedAsset::Open(
+    const std::shared_ptr<ArAsset>& compressedAsset,
+    size_t maxCachedFrames)
+{
+    if (!compressedAsset) {
+        TF_CODING_ERROR("Invalid compressed asset");
+        return nullptr;
+    }
+
+    if (!IsSupported()) {
+        TF_RUNTIME_ERROR(
+            "Cannot open compressed asset: Ar was built without zstd "
+            "support");
+        return nullptr;
+    }
+
+    const size_t compressedSize = compressedAsset->GetSize();
+
+    char footer[_SeekTableFooterSize];
+    if (compressedSize < _SkippableFrameHeaderSize + _SeekTableFooterSize ||
+        compressedAsset->Read(
+            footer, sizeof(footer), compressedSize - sizeof(footer)) !=
+            sizeof(footer) ||
+        _ReadU32(footer + 5) != _SeekableMagic) {
+        TF_RUNTIME_ERROR("Asset is not in the zstd seekable format");
+        return nullptr;
+    }
+
+    const uint64_t numFrames = _ReadU32(footer);
+    const uint8_t descriptor = static_cast<uint8_t>(footer[4]);
+    const size_t entrySize = _SeekTableEntrySize +
+        ((descriptor & _ChecksumFlag) ? _SeekTableChecksumSize : 0);
+
+    // The skippable frame's size covers the seek table entries and footer
+    // but not its own header.
+    const uint64_t tableSize = numFrames * entrySize + _SeekTableFooterSize;
+    if (tableSize + _SkippableFrameHeaderSize > compressedSize) {
+        TF_RUNTIME_ERROR("Invalid zstd seek table");
+        return nullptr;
+    }
+
+    const size_t tableOffset =
+        compressedSize - tableSize - _SkippableFrameHeaderSize;
+    std::vector<char> table(tableSize + _SkippableFrameHeaderSize);
+    if (compressedAsset->Read(table.data(), table.size(), tableOffset) !=
+            table.size() ||
+        _ReadU32(table.data()) != _SkippableFrameMagic ||
+        _ReadU32(table.data() + 4) != tableSize) {
+        TF_RUNTIME_ERROR("Invalid zstd seek table");
+        return nullptr;
+    }
+
+    // Checksums in the seek table are not verified here; zstd verifies
+    // each frame's own checksum, if present, when it is decompressed.
+    std::vector<_Frame> frames;
+    frames.reserve(numFrames);
+    uint64_t compressedOffset = 0, decompressedOffset = 0;
+    const char* entry = table.data() + _SkippableFrameHeaderSize;
+    for (uint64_t i = 0; i < numFrames; ++i, entry += entrySize) {
+        _Frame frame;
+        frame.compressedOffset = compressedOffset;
+        frame.decompressedOffset = decompressedOffset;
+        frame.compressedSize = _ReadU32(entry);
+        frame.decompressedSize = _ReadU32(entry + 4);
+
+        compressedOffset += frame.compressedSize;
+        decompressedOffset += frame.decompressedSize;
+        if (compressedOffset > tableOffset) {
+            TF_RUNTIME_ERROR("Invalid zstd seek table");
+            return nullptr;
+        }
+
+        // Empty frames never need to be decompressed.
+        if (frame.decompressedSize > 0) {
+            frames.push_back(frame);
+        }
+    }
+
+    return std::make_shared<ArSeekableCompressedAsset>(
+        compressedAsset, std::move(frames), std::max<size_t>(maxCachedFrames, 1),
+        PrivateCtorTag());
+}
+
+bool
+ArSeekableCompressedAsset::IsSupported()
+{
+#if defined(AR_WITH_ZSTD)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool
+ArSeekableCompressedAsset::IsEnabledForExtension(const std::string& extension)
+{
+    if (!IsSupported()) {
+        return false;
+    }
+
+    static const std::set<std::string> enabledExtensions = []() {
+        std::set<std::string> extensions;
+        for (const std::string& ext : TfStringTokenize(
+                 TfGetEnvSetting(PXR_AR_SEEKABLE_COMPRESSED_EXTENSIONS),
+                 ", ")) {
+            extensions.insert(TfStringToLowerAscii(ext));
+        }
+        return extensions;
+    }();
+
+    return !enabledExtensions.empty() &&
+        enabledExtensions.count(TfStringToLowerAscii(extension)) != 0;
+}
+
+ArSeekableCompressedAsset::ArSeekableCompressedAsset(
+    const std::shared_ptr<ArAsset>& compressedAsset,
+    std::vector<_Frame>&& frames,
+    size_t maxCachedFrames,
+    PrivateCtorTag)
+    : _compressedAsset(compressedAsset)
+    , _frames(std::move(frames))
+    , _size(_frames.empty() ? 0 :
+        _frames.back().decompressedOffset + _frames.back().decompressedSize)
+    , _maxCachedFrames(maxCachedFrames)
+{
+}
+
+ArSeekableCompressedAsset::~ArSeekableCompressedAsset() = default;
+
+size_t
+ArSeekableCompressedAsset::GetSize() const
+{
+    return _size;
+}
+
+std::shared_ptr<const char>
+ArSeekableCompressedAsset::GetBuffer() const
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (std::shared_ptr<const char> buffer = _buffer.lock()) {
+            return buffer;
+        }
+    }
+
+    std::shared_ptr<char> buffer;
+    try {
+        buffer.reset(new char[_size], std::default_delete<char[]>());
+    }
+    catch (const std::bad_alloc&) {
+        TF_RUNTIME_ERROR(
+            "Could not allocate %zu bytes for decompressed asset", _size);
+        return nullptr;
+    }
+
+    for (size_t i = 0, e = _frames.size(); i != e; ++i) {
+        if (!_DecompressFrame(i, buffer.get() + _frames[i].decompressedOffset)) {
+            return nullptr;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _buffer = buffer;
+    return buffer;
+}
+
+size_t
+ArSeekableCompressedAsset::Read(
+    void* buffer, size_t count, size_t offset) const
+{
+    if (offset >= _size) {
+        return 0;
+    }
+    count = std::min(count, _size - offset);
+
+    // Find the first frame containing the requested range.
+    auto frameIt = std::upper_bound(
+        _frames.begin(), _frames.end(), offset,
+        [](size_t offset, const _Frame& frame) {
+            return offset < frame.decompressedOffset;
+        });
+    --frameIt;
+
+    char* dst = static_cast<char*>(buffer);
+    size_t numRead = 0;
+    for (; numRead < count && frameIt != _frames.end(); ++frameIt) {
+        const std::shared_ptr<const char> frameData =
+            _GetFrame(frameIt - _frames.begin());
+        if (!frameData) {
+            break;
+        }
+
+        const size_t frameOffset =
+            offset + numRead - frameIt->decompressedOffset;
+        const size_t numToCopy = std::min<size_t>(
+            count - numRead, frameIt->decompressedSize - frameOffset);
+        memcpy(dst + numRead, frameData.get() + frameOffset, numToCopy);
+        numRead += numToCopy;
+    }
+
+    return numRead;
+}
+
+std::pair<FILE*, size_t>
+ArSeekableCompressedAsset::GetFileUnsafe() const
+{
+    return std::make_pair(nullptr, 0);
+}
+
+std::shared_ptr<const char>
+ArSeekableCompressedAsset::_GetFrame(size_t frameIndex) const
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto it = _frameCache.begin(); it != _frameCache.end(); ++it) {
+            if (it->first == frameIndex) {
+                _frameCache.splice(_frameCache.begin(), _frameCache, it);
+                return it->second;
+            }
+        }
+    }
+
+    // Decompress without holding the lock so other threads can read
+    // other frames in the meantime.
+    std::shared_ptr<char> frameData;
+    try {
+        frameData.reset(
+            new char[_frames[frameIndex].decompressedSize],
+            std::default_delete<char[]>());
+    }
+    catch (const std::bad_alloc&) {
+        TF_RUNTIME_ERROR(
+            "Could not allocate %u bytes for decompressed frame",
+            _frames[frameIndex].decompressedSize);
+        return nullptr;
+    }
+
+    if (!_DecompressFrame(frameIndex, frameData.get())) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _frameCache.emplace_front(frameIndex, frameData);
+    if (_frameCache.size() > _maxCachedFrames) {
+        _frameCache.pop_back();
+    }
+    return frameData;
+}
+
+bool
+ArSeekableCompressedAsset::_DecompressFrame(
+    size_t frameIndex, char* buffer) const
+{
+#if defined(AR_WITH_ZSTD)
+    const _Frame& frame = _frames[frameIndex];
+
+    std::unique_ptr<char[]> compressed(new char[frame.compressedSize]);
+    if (_compressedAsset->Read(
+            compressed.get(), frame.compressedSize, frame.compressedOffset) !=
+        frame.compressedSize) {
+        TF_RUNTIME_ERROR(
+            "Could not read compressed frame %zu", frameIndex);
+        return false;
+    }
+
+    const size_t result = ZSTD_decompress(
+        buffer, frame.decompressedSize,
+        compressed.get(), frame.compressedSize);
+    if (ZSTD_isError(result) || result != frame.decompressedSize) {
+        TF_RUNTIME_ERROR(
+            "Could not decompress frame %zu: %s", frameIndex,
+            ZSTD_isError(result) ? ZSTD_getErrorName(result) :
+                "unexpected size");
+        return false;
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+}  // namespace pxr
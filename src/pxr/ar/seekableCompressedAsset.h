@@ -0,0 +1,142 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#ifndef PXR_AR_SEEKABLE_COMPRESSED_ASSET_H
+#define PXR_AR_SEEKABLE_COMPRESSED_ASSET_H
+
+/// \file ar/seekableCompressedAsset.h
+
+#include "./api.h"
+#include "./asset.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pxr {
+
+/// \class ArSeekableCompressedAsset
+///
+/// ArAsset implementation that provides the decompressed contents of an
+/// asset stored in the zstd seekable format.
+///
+/// The seekable format splits the compressed data into independent frames
+/// and appends a seek table describing them. This allows Read to decompress
+/// only the frames overlapping the requested range instead of the entire
+/// asset. Recently decompressed frames are kept in a small cache so that
+/// sequential reads don't decompress the same frame repeatedly.
+///
+/// This requires Ar to be built with zstd support via the ENABLE_ZSTD
+/// CMake option. Otherwise, Open always fails.
+///
+/// ArDefaultResolver opens files through this class if their extension is
+/// listed in the PXR_AR_SEEKABLE_COMPRESSED_EXTENSIONS environment setting.
+/// Package resolvers and other resolvers may use Open on any asset in the
+/// seekable format.
+class ArSeekableCompressedAsset
+    : public ArAsset
+{
+public:
+    /// Returns an asset providing the decompressed contents of
+    /// \p compressedAsset, which must be in the zstd seekable format. Up to
+    /// \p maxCachedFrames decompressed frames are kept in memory.
+    ///
+    /// Returns nullptr and issues an error if \p compressedAsset is not in
+    /// the seekable format or if Ar was built without zstd support.
+    AR_API
+    static std::shared_ptr<ArSeekableCompressedAsset> Open(
+        const std::shared_ptr<ArAsset>& compressedAsset,
+        size_t maxCachedFrames = 8);
+
+    /// Returns true if Ar was built with zstd support.
+    AR_API
+    static bool IsSupported();
+
+    /// Returns true if assets with the given file \p extension should be
+    /// opened with this class, as specified by the
+    /// PXR_AR_SEEKABLE_COMPRESSED_EXTENSIONS environment setting. This is a
+    /// comma-separated list of extensions, which is empty by default.
+    /// Always returns false if Ar was built without zstd support.
+    AR_API
+    static bool IsEnabledForExtension(const std::string& extension);
+
+    AR_API
+    ~ArSeekableCompressedAsset();
+
+    /// Returns the size of the decompressed contents.
+    AR_API
+    virtual size_t GetSize() const override;
+
+    /// Returns a buffer holding the entire decompressed contents. This
+    /// requires decompressing every frame; the buffer is shared with other
+    /// callers for as long as any of them hold on to it.
+    AR_API
+    virtual std::shared_ptr<const char> GetBuffer() const override;
+
+    /// Reads \p count bytes of the decompressed contents at the given
+    /// \p offset into \p buffer, decompressing only the frames that overlap
+    /// that range.
+    AR_API
+    virtual size_t Read(void* buffer, size_t count, size_t offset) const override;
+
+    /// Returns { nullptr, 0 } since the decompressed contents are not
+    /// available in a file.
+    AR_API
+    virtual std::pair<FILE*, size_t> GetFileUnsafe() const override;
+
+    /// Returns the number of compressed frames in the asset.
+    size_t GetNumFrames() const
+    {
+        return _frames.size();
+    }
+
+private:
+    struct _Frame
+    {
+        uint64_t compressedOffset;
+        uint64_t decompressedOffset;
+        uint32_t compressedSize;
+        uint32_t decompressedSize;
+    };
+
+    struct PrivateCtorTag {};
+public:
+    // "Private" c'tor. Must actually be public for std::make_shared,
+    // but the PrivateCtorTag prevents other code from using this.
+    ArSeekableCompressedAsset(
+        const std::shared_ptr<ArAsset>& compressedAsset,
+        std::vector<_Frame>&& frames,
+        size_t maxCachedFrames,
+        PrivateCtorTag);
+
+private:
+    // Returns the decompressed contents of the frame at \p frameIndex,
+    // using the frame cache if possible.
+    std::shared_ptr<const char> _GetFrame(size_t frameIndex) const;
+
+    // Decompresses the frame at \p frameIndex into \p buffer.
+    bool _DecompressFrame(size_t frameIndex, char* buffer) const;
+
+    std::shared_ptr<ArAsset> _compressedAsset;
+    std::vector<_Frame> _frames;
+    size_t _size;
+
+    // Most recently used frames are at the front.
+    using _FrameCache =
+        std::list<std::pair<size_t, std::shared_ptr<const char>>>;
+    mutable std::mutex _mutex;
+    mutable _FrameCache _frameCache;
+    size_t _maxCachedFrames;
+    mutable std::weak_ptr<const char> _buffer;
+};
+
+}  // namespace pxr
+
+#endif // PXR_AR_SEEKABLE_COMPRESSED_ASSET_H
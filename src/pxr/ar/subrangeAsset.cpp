@@ -0,0 +1,119 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include "./subrangeAsset.h"
+
+#include <pxr/tf/diagnostic.h>
+
+#include <algorithm>
+
+namespace pxr {
+
+ArSubrangeAsset::ArSubrangeAsset(
+    const std::shared_ptr<ArAsset>& parent,
+    size_t offset,
+    size_t size)
+    : ArSubrangeAsset(parent, nullptr, offset, size)
+{
+}
+
+ArSubrangeAsset::ArSubrangeAsset(
+    const std::shared_ptr<ArAsset>& parent,
+    const std::shared_ptr<const char>& parentBuffer,
+    size_t offset,
+    size_t size)
+    : _parent(parent)
+    , _offset(offset)
+    , _size(size)
+{
+    if (!_parent) {
+        TF_CODING_ERROR("Invalid parent asset");
+        _offset = 0;
+        _size = 0;
+        return;
+    }
+
+    const size_t parentSize = _parent->GetSize();
+    if (_offset > parentSize || _size > parentSize - _offset) {
+        TF_CODING_ERROR(
+            "Range [%zu, %zu) exceeds parent asset size %zu",
+            offset, offset + size, parentSize);
+        _offset = std::min(_offset, parentSize);
+        _size = std::min(_size, parentSize - _offset);
+    }
+
+    if (parentBuffer) {
+        _buffer = std::shared_ptr<const char>(
+            parentBuffer, parentBuffer.get() + _offset);
+    }
+
+    // Refer directly to the outermost asset so that ranges in nested
+    // packages don't forward through every level of nesting.
+    if (const ArSubrangeAsset* parentRange =
+            dynamic_cast<const ArSubrangeAsset*>(_parent.get())) {
+        if (!_buffer && parentRange->_buffer) {
+            _buffer = std::shared_ptr<const char>(
+                parentRange->_buffer, parentRange->_buffer.get() + _offset);
+        }
+        _offset += parentRange->_offset;
+        _parent = parentRange->_parent;
+    }
+}
+
+ArSubrangeAsset::~ArSubrangeAsset() = default;
+
+size_t
+ArSubrangeAsset::GetSize() const
+{
+    return _size;
+}
+
+std::shared_ptr<const char>
+ArSubrangeAsset::GetBuffer() const
+{
+    if (_buffer) {
+        return _buffer;
+    }
+
+    if (!_parent) {
+        return nullptr;
+    }
+
+    std::shared_ptr<const char> parentBuffer = _parent->GetBuffer();
+    if (!parentBuffer) {
+        return nullptr;
+    }
+
+    // Share ownership of the parent's buffer so the returned pointer
+    // remains valid as long as it is held.
+    const char* start = parentBuffer.get() + _offset;
+    return std::shared_ptr<const char>(std::move(parentBuffer), start);
+}
+
+size_t
+ArSubrangeAsset::Read(void* buffer, size_t count, size_t offset) const
+{
+    if (!_parent || offset >= _size) {
+        return 0;
+    }
+    return _parent->Read(
+        buffer, std::min(count, _size - offset), _offset + offset);
+}
+
+std::pair<FILE*, size_t>
+ArSubrangeAsset::GetFileUnsafe() const
+{
+    if (!_parent) {
+        return std::make_pair(nullptr, 0);
+    }
+
+    const std::pair<FILE*, size_t> parentFile = _parent->GetFileUnsafe();
+    if (!parentFile.first) {
+        return std::make_pair(nullptr, 0);
+    }
+    return std::make_pair(parentFile.first, parentFile.second + _offset);
+}
+
+}  // namespace pxr
@@ -0,0 +1,118 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#ifndef PXR_AR_SUBRANGE_ASSET_H
+#define PXR_AR_SUBRANGE_ASSET_H
+
+/// \file ar/subrangeAsset.h
+
+#include "./api.h"
+#include "./asset.h"
+
+#include <cstdio>
+#include <memory>
+#include <utility>
+
+namespace pxr {
+
+/// \class ArSubrangeAsset
+///
+/// ArAsset implementation for a contiguous range of bytes in another asset.
+///
+/// This is useful for package resolvers whose packages store files without
+/// compression. The contents of the range are never copied: reads are
+/// forwarded to the parent asset, GetBuffer returns a pointer into the
+/// parent asset's buffer and GetFileUnsafe returns the parent asset's file
+/// with the offset of the range applied.
+///
+/// Creating an ArSubrangeAsset for a range in another ArSubrangeAsset
+/// refers directly to the outermost parent asset, so assets in nested
+/// packages can be accessed without additional overhead regardless of how
+/// deeply they are nested.
+///
+/// Package resolvers that already hold the parent asset's buffer can pass
+/// it when constructing the range. GetBuffer then returns a pointer into
+/// that buffer instead of asking the parent asset for its buffer again,
+/// which for file-backed assets would map the whole file each time.
+class ArSubrangeAsset
+    : public ArAsset
+{
+public:
+    /// Constructs an asset for the \p size bytes starting at \p offset in
+    /// \p parent. The parent asset is kept alive by this object.
+    ///
+    /// If \p parent is null or the range is not contained in \p parent,
+    /// a coding error is issued and the range is clamped to the contents
+    /// of \p parent.
+    AR_API
+    ArSubrangeAsset(
+        const std::shared_ptr<ArAsset>& parent,
+        size_t offset,
+        size_t size);
+
+    /// Constructs an asset for the \p size bytes starting at \p offset in
+    /// \p parent, where \p parentBuffer holds the contents of \p parent.
+    /// GetBuffer returns a pointer into \p parentBuffer, while reads are
+    /// still forwarded to \p parent.
+    AR_API
+    ArSubrangeAsset(
+        const std::shared_ptr<ArAsset>& parent,
+        const std::shared_ptr<const char>& parentBuffer,
+        size_t offset,
+        size_t size);
+
+    AR_API
+    ~ArSubrangeAsset();
+
+    /// Returns the asset containing this range. This is never another
+    /// ArSubrangeAsset.
+    const std::shared_ptr<ArAsset>& GetParent() const
+    {
+        return _parent;
+    }
+
+    /// Returns the offset of this range in the asset returned by GetParent.
+    size_t GetOffset() const
+    {
+        return _offset;
+    }
+
+    /// Returns the size of this range.
+    AR_API
+    virtual size_t GetSize() const override;
+
+    /// Returns a pointer to the start of this range in the parent asset's
+    /// buffer. The returned pointer shares ownership of the parent asset's
+    /// buffer. If a buffer was given when constructing this range, it is
+    /// used instead of the parent asset's GetBuffer.
+    AR_API
+    virtual std::shared_ptr<const char> GetBuffer() const override;
+
+    /// Reads \p count bytes at the given \p offset in this range from the
+    /// parent asset into \p buffer.
+    AR_API
+    virtual size_t Read(
+        void* buffer, size_t count, size_t offset) const override;
+
+    /// Returns the parent asset's FILE* handle, with the offset of this
+    /// range added to the parent asset's offset. Returns { nullptr, 0 } if
+    /// the parent asset is not associated with a file.
+    AR_API
+    virtual std::pair<FILE*, size_t> GetFileUnsafe() const override;
+
+private:
+    std::shared_ptr<ArAsset> _parent;
+
+    // Pointer to the start of this range in the buffer given at
+    // construction, if any.
+    std::shared_ptr<const char> _buffer;
+
+    size_t _offset;
+    size_t _size;
+};
+
+}  // namespace pxr
+
+#endif // PXR_AR_SUBRANGE_ASSET_H
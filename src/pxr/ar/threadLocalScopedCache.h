@@ -14,11 +14,62 @@
 #include <pxr/tf/diagnostic.h>
 
 #include <tbb/enumerable_thread_specific.h>
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
 namespace pxr {
 
+/// \class Ar_ThreadSpecific
+///
+/// Wrapper around tbb::enumerable_thread_specific that caches the calling
+/// thread's element for the most recently accessed instance in a native
+/// thread_local variable. Processes typically have a single instance of
+/// each type, so lookups usually avoid the enumerable_thread_specific's
+/// hash lookup by thread id.
+template <class T>
+class Ar_ThreadSpecific
+{
+public:
+    Ar_ThreadSpecific()
+        : _id(++_GetNextId())
+    {
+    }
+
+    Ar_ThreadSpecific(const Ar_ThreadSpecific&) = delete;
+    Ar_ThreadSpecific& operator=(const Ar_ThreadSpecific&) = delete;
+
+    /// Returns the calling thread's element.
+    T& Local()
+    {
+        // Instance ids are never reused, so a cached element from an
+        // instance that has since been destroyed will never match.
+        static thread_local _Cached cached;
+        if (cached.id != _id) {
+            cached.id = _id;
+            cached.local = &_ets.local();
+        }
+        return *cached.local;
+    }
+
+private:
+    struct _Cached
+    {
+        uint64_t id = 0;
+        T* local = nullptr;
+    };
+
+    static std::atomic<uint64_t>& _GetNextId()
+    {
+        static std::atomic<uint64_t> nextId(0);
+        return nextId;
+    }
+
+    const uint64_t _id;
+    tbb::enumerable_thread_specific<T> _ets;
+};
+
 /// \class ArThreadLocalScopedCache
 ///
 /// Utility class for custom resolver implementations. This class wraps up
@@ -35,7 +86,7 @@ namespace pxr {
 ///     void Resolve(...) {
 ///         // If caching is active in this thread, retrieve the current
 ///         // cache and use it to lookup/store values.
-///         if (ResolveCache::CachePtr cache = _cache.GetCurrentCache()) {
+///         if (auto* cache = _cache.BorrowCurrentCache()) {
 ///             // ...
 ///         }
 ///         // Otherwise, caching is not active
@@ -63,7 +114,7 @@ public:
             return;
         }
 
-        _CachePtrStack& cacheStack = _threadCacheStack.local();
+        _CachePtrStack& cacheStack = _threadCacheStack.Local();
         if (cacheScopeData->IsHolding<CachePtr>()) {
             cacheStack.push_back(cacheScopeData->UncheckedGet<CachePtr>());
         }
@@ -80,7 +131,7 @@ public:
 
     void EndCacheScope(VtValue* cacheScopeData)
     {
-        _CachePtrStack& cacheStack = _threadCacheStack.local();
+        _CachePtrStack& cacheStack = _threadCacheStack.Local();
         if (TF_VERIFY(!cacheStack.empty())) {
             cacheStack.pop_back();
         }
@@ -88,14 +139,22 @@ public:
 
     CachePtr GetCurrentCache()
     {
-        _CachePtrStack& cacheStack = _threadCacheStack.local();
+        _CachePtrStack& cacheStack = _threadCacheStack.Local();
         return (cacheStack.empty() ? CachePtr() : cacheStack.back());
     }
 
+    /// Returns the current cache in this thread without taking a reference
+    /// to it, or nullptr if caching is not active. The returned pointer
+    /// remains valid until the innermost cache scope in this thread ends.
+    CachedType* BorrowCurrentCache()
+    {
+        _CachePtrStack& cacheStack = _threadCacheStack.Local();
+        return (cacheStack.empty() ? nullptr : cacheStack.back().get());
+    }
+
 private:
     using _CachePtrStack = std::vector<CachePtr>;
-    using _ThreadLocalCachePtrStack = 
-        tbb::enumerable_thread_specific<_CachePtrStack>;
+    using _ThreadLocalCachePtrStack = Ar_ThreadSpecific<_CachePtrStack>;
     _ThreadLocalCachePtrStack _threadCacheStack;
 };
 
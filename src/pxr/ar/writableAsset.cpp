@@ -7,10 +7,58 @@
 
 #include "./writableAsset.h"
 
+#include <algorithm>
+
 namespace pxr {
 
 ArWritableAsset::ArWritableAsset() = default;
 
 ArWritableAsset::~ArWritableAsset() = default;
 
+size_t
+ArWritableAsset::WriteRanges(
+    const WriteRequest* requests, size_t numRequests)
+{
+    size_t numWritten = 0;
+    for (size_t i = 0; i < numRequests; ++i) {
+        const WriteRequest& request = requests[i];
+        const size_t n =
+            Write(request.buffer, request.count, request.offset);
+        numWritten += n;
+        if (n != request.count) {
+            break;
+        }
+    }
+    return numWritten;
+}
+
+bool
+ArWritableAsset::Reserve(size_t /* totalSize */)
+{
+    return false;
+}
+
+std::vector<ArWriteRegion>
+ArSplitWriteRegions(size_t totalSize, size_t numRegions, size_t alignment)
+{
+    std::vector<ArWriteRegion> regions;
+    if (totalSize == 0) {
+        return regions;
+    }
+
+    numRegions = std::max<size_t>(numRegions, 1);
+    alignment = std::max<size_t>(alignment, 1);
+
+    // Round the per-region size up to the next multiple of alignment. Only
+    // the last region may end at an unaligned offset.
+    size_t regionSize = (totalSize + numRegions - 1) / numRegions;
+    regionSize = ((regionSize + alignment - 1) / alignment) * alignment;
+
+    regions.reserve(std::min(numRegions, totalSize / regionSize + 1));
+    for (size_t offset = 0; offset < totalSize; offset += regionSize) {
+        regions.push_back({offset, std::min(regionSize, totalSize - offset)});
+    }
+    return regions;
+}
+
 }  // namespace pxr
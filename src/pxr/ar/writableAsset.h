@@ -13,6 +13,7 @@
 #include "./api.h"
 
 #include <cstdio>
+#include <vector>
 
 namespace pxr {
 
@@ -42,13 +43,94 @@ public:
 
     /// Writes \p count bytes from \p buffer at \p offset from the beginning
     /// of the asset. Returns number of bytes written, or 0 on error.
+    ///
+    /// Implementations must allow multiple threads to call this function
+    /// concurrently as long as the ranges being written do not overlap.
+    /// This allows clients to serialize different regions of an asset in
+    /// parallel; see ArSplitWriteRegions. The result of concurrent writes
+    /// to overlapping ranges is undefined.
     virtual size_t Write(const void* buffer, size_t count, size_t offset) = 0;
 
+    /// \struct WriteRequest
+    ///
+    /// A single write of \p count bytes from \p buffer at \p offset from
+    /// the beginning of the asset.
+    struct WriteRequest
+    {
+        const void* buffer = nullptr;
+        size_t count = 0;
+        size_t offset = 0;
+    };
+
+    /// Performs the \p numRequests writes in \p requests in order, as if
+    /// by calling Write for each of them. Returns the total number of bytes
+    /// written. If an error occurs, no further requests are processed and
+    /// the number of bytes written before the error is returned.
+    ///
+    /// This allows writers that produce scattered pieces of output, such as
+    /// a header, index tables and payload blocks, to write them all at once
+    /// without first concatenating them into a staging buffer.
+    /// Implementations may combine requests whose ranges are adjacent into
+    /// a single operation.
+    ///
+    /// The default implementation calls Write for each request.
+    AR_API
+    virtual size_t WriteRanges(
+        const WriteRequest* requests, size_t numRequests);
+
+    /// Hints that this asset is expected to hold \p totalSize bytes once
+    /// all writes have completed. Implementations may use this to allocate
+    /// storage up front, which can reduce fragmentation and the number of
+    /// metadata updates performed while writing large assets.
+    ///
+    /// Reserving space does not change the size of the asset as observed
+    /// by readers; only data passed to Write determines the final contents.
+    /// Returns true if the space was reserved, false otherwise. Since this
+    /// is only a hint, writers should not treat a false return value as an
+    /// error.
+    ///
+    /// The default implementation does nothing and returns false.
+    AR_API
+    virtual bool Reserve(size_t totalSize);
+
 protected:
     AR_API
     ArWritableAsset();
 };
 
+/// \struct ArWriteRegion
+///
+/// A contiguous range of bytes in an ArWritableAsset.
+struct ArWriteRegion
+{
+    size_t offset = 0;
+    size_t size = 0;
+};
+
+/// Splits an asset of \p totalSize bytes into at most \p numRegions
+/// contiguous, non-overlapping regions that cover the entire asset, for
+/// example to write each region from a different thread.
+///
+/// Region boundaries are placed on multiples of \p alignment so that
+/// threads writing adjacent regions do not modify the same filesystem
+/// blocks. Because of this, and because empty regions are never returned,
+/// fewer than \p numRegions regions may be returned for small assets.
+///
+/// \code
+/// std::vector<ArWriteRegion> regions = ArSplitWriteRegions(
+///     totalSize, std::thread::hardware_concurrency());
+/// asset->Reserve(totalSize);
+/// tbb::parallel_for_each(regions.begin(), regions.end(),
+///     [&](const ArWriteRegion& region) {
+///         asset->Write(data + region.offset, region.size, region.offset);
+///     });
+/// asset->Close();
+/// \endcode
+AR_API
+std::vector<ArWriteRegion>
+ArSplitWriteRegions(
+    size_t totalSize, size_t numRegions, size_t alignment = 4096);
+
 }  // namespace pxr
 
 #endif
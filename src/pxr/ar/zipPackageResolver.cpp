@@ -0,0 +1,510 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include "./zipPackageResolver.h"
+
+#include "./asset.h"
+#include "./definePackageResolver.h"
+#include "./inMemoryAsset.h"
+#include "./resolvedPath.h"
+#include "./resolver.h"
+#include "./subrangeAsset.h"
+
+#include <pxr/tf/diagnostic.h>
+#include <pxr/vt/value.h>
+
+#if defined(AR_WITH_ZLIB)
+#include <zlib.h>
+#endif
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+namespace pxr {
+
+AR_DEFINE_PACKAGE_RESOLVER(ArZipPackageResolver, ArPackageResolver);
+
+namespace
+{
+
+// Zip archives store all values in little-endian byte order.
+uint16_t
+_ReadU16(const char* p)
+{
+    const unsigned char* b = reinterpret_cast<const unsigned char*>(p);
+    return uint16_t(b[0]) | uint16_t(b[1]) << 8;
+}
+
+uint32_t
+_ReadU32(const char* p)
+{
+    return uint32_t(_ReadU16(p)) | uint32_t(_ReadU16(p + 2)) << 16;
+}
+
+uint64_t
+_ReadU64(const char* p)
+{
+    return uint64_t(_ReadU32(p)) | uint64_t(_ReadU32(p + 4)) << 32;
+}
+
+constexpr uint32_t _LocalFileHeaderSignature = 0x04034b50;
+constexpr uint32_t _CentralDirHeaderSignature = 0x02014b50;
+constexpr uint32_t _EndOfCentralDirSignature = 0x06054b50;
+constexpr uint32_t _Zip64EndOfCentralDirSignature = 0x06064b50;
+constexpr uint32_t _Zip64EndOfCentralDirLocatorSignature = 0x07064b50;
+
+constexpr size_t _LocalFileHeaderSize = 30;
+constexpr size_t _CentralDirHeaderSize = 46;
+constexpr size_t _EndOfCentralDirSize = 22;
+constexpr size_t _Zip64EndOfCentralDirSize = 56;
+constexpr size_t _Zip64EndOfCentralDirLocatorSize = 20;
+constexpr size_t _MaxCommentSize = 0xFFFF;
+
+constexpr uint16_t _Zip64ExtraFieldId = 0x0001;
+constexpr uint16_t _EncryptedFlag = 0x0001;
+
+constexpr uint16_t _StoredMethod = 0;
+constexpr uint16_t _DeflatedMethod = 8;
+
+// Returns true if the range [offset, offset + count) lies within an
+// object of the given size, guarding against overflow.
+bool
+_InRange(uint64_t offset, uint64_t count, uint64_t size)
+{
+    return offset <= size && count <= size - offset;
+}
+
+#if defined(AR_WITH_ZLIB)
+// Decompresses the raw deflate stream of \p compressedSize bytes at \p src
+// into \p dst, which must be able to hold \p uncompressedSize bytes.
+bool
+_Inflate(
+    const char* src, size_t compressedSize,
+    char* dst, size_t uncompressedSize)
+{
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+        return false;
+    }
+
+    // zlib's buffer sizes are 32-bit, so feed larger members through the
+    // stream in pieces.
+    size_t inRemaining = compressedSize, outRemaining = uncompressedSize;
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(src));
+    stream.next_out = reinterpret_cast<Bytef*>(dst);
+
+    int result = Z_OK;
+    while (result == Z_OK) {
+        if (stream.avail_in == 0 && inRemaining > 0) {
+            stream.avail_in = static_cast<uInt>(
+                std::min<size_t>(inRemaining, UINT_MAX));
+            inRemaining -= stream.avail_in;
+        }
+        if (stream.avail_out == 0 && outRemaining > 0) {
+            stream.avail_out = static_cast<uInt>(
+                std::min<size_t>(outRemaining, UINT_MAX));
+            outRemaining -= stream.avail_out;
+        }
+        result = inflate(&stream, Z_NO_FLUSH);
+    }
+
+    const bool success = result == Z_STREAM_END &&
+        outRemaining == 0 && stream.avail_out == 0;
+    inflateEnd(&stream);
+    return success;
+}
+
+uint32_t
+_ComputeCrc32(const char* data, size_t size)
+{
+    uLong crc = crc32(0L, Z_NULL, 0);
+    while (size > 0) {
+        const uInt chunkSize = static_cast<uInt>(
+            std::min<size_t>(size, UINT_MAX));
+        crc = crc32(crc, reinterpret_cast<const Bytef*>(data), chunkSize);
+        data += chunkSize;
+        size -= chunkSize;
+    }
+    return static_cast<uint32_t>(crc);
+}
+#endif
+
+// Reads the central directory of the zip archive in \p data and adds a
+// record for each file to \p index. Returns false if the archive is invalid.
+bool
+_ReadCentralDirectory(
+    const char* data, size_t size, ArPackageIndexCache::Index* index)
+{
+    if (size < _EndOfCentralDirSize) {
+        return false;
+    }
+
+    // The end of central directory record is at the end of the archive,
+    // followed only by a variable-length comment.
+    const size_t minEndOffset =
+        size - _EndOfCentralDirSize - std::min(size - _EndOfCentralDirSize,
+                                                _MaxCommentSize);
+    size_t endOffset = size - _EndOfCentralDirSize;
+    while (_ReadU32(data + endOffset) != _EndOfCentralDirSignature) {
+        if (endOffset == minEndOffset) {
+            return false;
+        }
+        --endOffset;
+    }
+
+    const char* end = data + endOffset;
+    uint64_t numEntries = _ReadU16(end + 10);
+    uint64_t centralDirSize = _ReadU32(end + 12);
+    uint64_t centralDirOffset = _ReadU32(end + 16);
+
+    // Archives with too many entries or that are too large to be described
+    // by the end of central directory record store these values in the
+    // zip64 end of central directory record instead.
+    if ((numEntries == 0xFFFF || centralDirSize == 0xFFFFFFFF ||
+         centralDirOffset == 0xFFFFFFFF) &&
+        endOffset >= _Zip64EndOfCentralDirLocatorSize) {
+        const char* locator = end - _Zip64EndOfCentralDirLocatorSize;
+        if (_ReadU32(locator) == _Zip64EndOfCentralDirLocatorSignature) {
+            const uint64_t zip64EndOffset = _ReadU64(locator + 8);
+            if (_InRange(zip64EndOffset, _Zip64EndOfCentralDirSize, size) &&
+                _ReadU32(data + zip64EndOffset) ==
+                    _Zip64EndOfCentralDirSignature) {
+                const char* zip64End = data + zip64EndOffset;
+                numEntries = _ReadU64(zip64End + 32);
+                centralDirSize = _ReadU64(zip64End + 40);
+                centralDirOffset = _ReadU64(zip64End + 48);
+            }
+        }
+    }
+
+    if (!_InRange(centralDirOffset, centralDirSize, size)) {
+        return false;
+    }
+
+    const char* record = data + centralDirOffset;
+    const char* centralDirEnd = record + centralDirSize;
+    for (uint64_t i = 0; i < numEntries; ++i) {
+        if (!_InRange(
+                record - data, _CentralDirHeaderSize, centralDirEnd - data) ||
+            _ReadU32(record) != _CentralDirHeaderSignature) {
+            return false;
+        }
+
+        // The member's offset is the offset of its local header, since
+        // finding its data requires reading that header.
+        ArPackageIndexCache::Member member;
+        member.flags = _ReadU16(record + 8);
+        member.compression = _ReadU16(record + 10);
+        member.checksum = _ReadU32(record + 16);
+        member.compressedSize = _ReadU32(record + 20);
+        member.size = _ReadU32(record + 24);
+        const uint16_t nameLength = _ReadU16(record + 28);
+        const uint16_t extraLength = _ReadU16(record + 30);
+        const uint16_t commentLength = _ReadU16(record + 32);
+        member.offset = _ReadU32(record + 42);
+
+        const size_t recordSize =
+            _CentralDirHeaderSize + nameLength + extraLength + commentLength;
+        if (!_InRange(record - data, recordSize, centralDirEnd - data)) {
+            return false;
+        }
+
+        const char* name = record + _CentralDirHeaderSize;
+        const char* extra = name + nameLength;
+
+        // Values that don't fit in 32 bits are stored in the zip64 extra
+        // field, in this order, only if the corresponding value in the
+        // record is 0xFFFFFFFF.
+        for (const char* field = extra;
+             field + 4 <= extra + extraLength; ) {
+            const uint16_t fieldId = _ReadU16(field);
+            const uint16_t fieldSize = _ReadU16(field + 2);
+            const char* value = field + 4;
+            const char* fieldEnd = value + fieldSize;
+            if (fieldEnd > extra + extraLength) {
+                break;
+            }
+
+            if (fieldId == _Zip64ExtraFieldId) {
+                for (uint64_t* v : { &member.size,
+                                     &member.compressedSize,
+                                     &member.offset }) {
+                    if (*v == 0xFFFFFFFF && value + 8 <= fieldEnd) {
+                        *v = _ReadU64(value);
+                        value += 8;
+                    }
+                }
+                break;
+            }
+
+            field = fieldEnd;
+        }
+
+        // Skip directories, which only exist to record their own names.
+        if (nameLength > 0 && name[nameLength - 1] != '/') {
+            index->AddMember(std::string(name, nameLength), member);
+        }
+
+        record += recordSize;
+    }
+
+    return true;
+}
+
+} // end anonymous namespace
+
+ArZipPackageResolver::ArZipPackageResolver() = default;
+
+ArZipPackageResolver::~ArZipPackageResolver() = default;
+
+std::string
+ArZipPackageResolver::Resolve(
+    const std::string& resolvedPackagePath,
+    const std::string& packagedPath)
+{
+    const ArPackageIndexCache::IndexConstPtr index =
+        _GetIndex(resolvedPackagePath);
+    return index && index->FindMember(packagedPath) ?
+        packagedPath : std::string();
+}
+
+std::shared_ptr<ArAsset>
+ArZipPackageResolver::OpenAsset(
+    const std::string& resolvedPackagePath,
+    const std::string& resolvedPackagedPath)
+{
+    const ArPackageIndexCache::IndexConstPtr index =
+        _GetIndex(resolvedPackagePath);
+    const ArPackageIndexCache::Member* member =
+        index ? index->FindMember(resolvedPackagedPath) : nullptr;
+    if (!member) {
+        return nullptr;
+    }
+
+    return _OpenMember(
+        resolvedPackagePath, resolvedPackagedPath, *member, *index);
+}
+
+std::vector<std::shared_ptr<ArAsset>>
+ArZipPackageResolver::OpenAssets(
+    const std::string& resolvedPackagePath,
+    const std::vector<std::string>& resolvedPackagedPaths)
+{
+    std::vector<std::shared_ptr<ArAsset>> assets(resolvedPackagedPaths.size());
+
+    const ArPackageIndexCache::IndexConstPtr index =
+        _GetIndex(resolvedPackagePath);
+    if (!index) {
+        return assets;
+    }
+
+    // Open the requested files in the order they are stored in the
+    // archive so its contents are read in a single sequential pass.
+    std::vector<std::pair<const ArPackageIndexCache::Member*, size_t>>
+        members;
+    members.reserve(resolvedPackagedPaths.size());
+    for (size_t i = 0, e = resolvedPackagedPaths.size(); i != e; ++i) {
+        if (const ArPackageIndexCache::Member* member =
+                index->FindMember(resolvedPackagedPaths[i])) {
+            members.emplace_back(member, i);
+        }
+    }
+
+    std::sort(members.begin(), members.end(),
+        [](const auto& lhs, const auto& rhs) {
+            return lhs.first->offset < rhs.first->offset;
+        });
+
+    for (const auto& member : members) {
+        assets[member.second] = _OpenMember(
+            resolvedPackagePath, resolvedPackagedPaths[member.second],
+            *member.first, *index);
+    }
+
+    return assets;
+}
+
+std::shared_ptr<ArAsset>
+ArZipPackageResolver::_OpenMember(
+    const std::string& resolvedPackagePath,
+    const std::string& resolvedPackagedPath,
+    const ArPackageIndexCache::Member& member,
+    const ArPackageIndexCache::Index& index)
+{
+    if (member.flags & _EncryptedFlag) {
+        TF_RUNTIME_ERROR(
+            "Cannot open encrypted file '%s' in zip archive '%s'",
+            resolvedPackagedPath.c_str(), resolvedPackagePath.c_str());
+        return nullptr;
+    }
+
+    // The index holds on to the archive it was read from.
+    const std::shared_ptr<ArAsset>& archive = index.GetPackageAsset();
+    const size_t archiveSize = archive->GetSize();
+
+    // The file's data follows its local header, whose variable-length
+    // fields may differ from those in the central directory.
+    const char* data = index.GetPackageBuffer().get();
+    if (!_InRange(member.offset, _LocalFileHeaderSize, archiveSize) ||
+        _ReadU32(data + member.offset) != _LocalFileHeaderSignature) {
+        TF_RUNTIME_ERROR(
+            "Invalid header for file '%s' in zip archive '%s'",
+            resolvedPackagedPath.c_str(), resolvedPackagePath.c_str());
+        return nullptr;
+    }
+
+    const char* localHeader = data + member.offset;
+    const uint64_t dataOffset = member.offset +
+        _LocalFileHeaderSize + _ReadU16(localHeader + 26) +
+        _ReadU16(localHeader + 28);
+    if (!_InRange(dataOffset, member.compressedSize, archiveSize)) {
+        TF_RUNTIME_ERROR(
+            "Invalid size for file '%s' in zip archive '%s'",
+            resolvedPackagedPath.c_str(), resolvedPackagePath.c_str());
+        return nullptr;
+    }
+
+    if (member.compression == _StoredMethod) {
+        if (member.compressedSize != member.size) {
+            TF_RUNTIME_ERROR(
+                "Invalid size for file '%s' in zip archive '%s'",
+                resolvedPackagedPath.c_str(), resolvedPackagePath.c_str());
+            return nullptr;
+        }
+        // Use the archive contents the index already holds, so getting
+        // the member's buffer doesn't read or map the archive again.
+        return std::make_shared<ArSubrangeAsset>(
+            archive, index.GetPackageBuffer(), dataOffset, member.size);
+    }
+
+    if (member.compression == _DeflatedMethod) {
+#if defined(AR_WITH_ZLIB)
+        std::shared_ptr<char> buffer;
+        try {
+            buffer.reset(
+                new char[member.size], std::default_delete<char[]>());
+        }
+        catch (const std::bad_alloc&) {
+            TF_RUNTIME_ERROR(
+                "Could not allocate %zu bytes for file '%s' in zip archive "
+                "'%s'", size_t(member.size), resolvedPackagedPath.c_str(),
+                resolvedPackagePath.c_str());
+            return nullptr;
+        }
+
+        if (member.size > 0 &&
+            (!_Inflate(data + dataOffset, member.compressedSize,
+                       buffer.get(), member.size) ||
+             _ComputeCrc32(buffer.get(), member.size) !=
+                 member.checksum)) {
+            TF_RUNTIME_ERROR(
+                "Could not decompress file '%s' in zip archive '%s'",
+                resolvedPackagedPath.c_str(), resolvedPackagePath.c_str());
+            return nullptr;
+        }
+
+        return ArInMemoryAsset::FromBuffer(
+            std::shared_ptr<const char>(std::move(buffer)), member.size);
+#else
+        TF_RUNTIME_ERROR(
+            "Cannot open compressed file '%s' in zip archive '%s': Ar was "
+            "built without zlib support", resolvedPackagedPath.c_str(),
+            resolvedPackagePath.c_str());
+        return nullptr;
+#endif
+    }
+
+    TF_RUNTIME_ERROR(
+        "Unsupported compression method %d for file '%s' in zip archive '%s'",
+        member.compression, resolvedPackagedPath.c_str(),
+        resolvedPackagePath.c_str());
+    return nullptr;
+}
+
+void
+ArZipPackageResolver::BeginCacheScope(
+    VtValue* cacheScopeData)
+{
+    _threadCache.BeginCacheScope(cacheScopeData);
+}
+
+void
+ArZipPackageResolver::EndCacheScope(
+    VtValue* cacheScopeData)
+{
+    _threadCache.EndCacheScope(cacheScopeData);
+}
+
+ArPackageIndexCache::IndexConstPtr
+ArZipPackageResolver::_GetIndex(
+    const std::string& resolvedPackagePath)
+{
+    // Within a cache scope, assume the archive doesn't change so we can
+    // skip checking its timestamp.
+    _Cache* const currentCache = _threadCache.BorrowCurrentCache();
+    if (currentCache) {
+        std::lock_guard<std::mutex> lock(currentCache->mutex);
+        const auto it = currentCache->indexes.find(resolvedPackagePath);
+        if (it != currentCache->indexes.end()) {
+            return it->second;
+        }
+    }
+
+    ArPackageIndexCache& indexCache = ArPackageIndexCache::GetInstance();
+    const ArTimestamp timestamp = ArGetResolver().GetModificationTimestamp(
+        resolvedPackagePath, ArResolvedPath(resolvedPackagePath));
+
+    ArPackageIndexCache::IndexConstPtr index =
+        indexCache.Find(resolvedPackagePath, timestamp);
+    if (!index) {
+        // Open the archive through Ar so that archives nested in other
+        // packages and archives in other asset systems are supported.
+        const std::shared_ptr<ArAsset> archive =
+            ArGetResolver().OpenAsset(ArResolvedPath(resolvedPackagePath));
+        if (!archive) {
+            return nullptr;
+        }
+
+        const std::shared_ptr<const char> buffer = archive->GetBuffer();
+        if (!buffer) {
+            TF_RUNTIME_ERROR(
+                "Could not read zip archive '%s'",
+                resolvedPackagePath.c_str());
+            return nullptr;
+        }
+
+        std::shared_ptr<ArPackageIndexCache::Index> newIndex =
+            std::make_shared<ArPackageIndexCache::Index>();
+        if (!_ReadCentralDirectory(
+                buffer.get(), archive->GetSize(), newIndex.get())) {
+            TF_RUNTIME_ERROR(
+                "Invalid zip archive '%s'", resolvedPackagePath.c_str());
+            return nullptr;
+        }
+
+        // Keep the archive open along with its index so that files in the
+        // archive can be opened without opening the archive again.
+        newIndex->SetPackage(archive, buffer);
+
+        // Without a valid timestamp we can't tell when the archive
+        // changes, so the index cache won't hold on to this index and it
+        // will only be reused within the current scope.
+        index = std::move(newIndex);
+        indexCache.Insert(resolvedPackagePath, timestamp, index);
+    }
+
+    if (currentCache) {
+        std::lock_guard<std::mutex> lock(currentCache->mutex);
+        currentCache->indexes.emplace(resolvedPackagePath, index);
+    }
+
+    return index;
+}
+
+}  // namespace pxr
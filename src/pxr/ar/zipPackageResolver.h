@@ -0,0 +1,108 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#ifndef PXR_AR_ZIP_PACKAGE_RESOLVER_H
+#define PXR_AR_ZIP_PACKAGE_RESOLVER_H
+
+/// \file ar/zipPackageResolver.h
+
+#include "./api.h"
+#include "./packageIndexCache.h"
+#include "./packageResolver.h"
+#include "./threadLocalScopedCache.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace pxr {
+
+/// \class ArZipPackageResolver
+///
+/// Package resolver for zip archives, registered for the "zip" extension.
+/// This allows assets stored in a zip archive to be addressed with
+/// package-relative paths like <tt>"/path/to/archive.zip[dir/asset.file]"</tt>.
+///
+/// The archive's central directory is parsed once and the resulting index
+/// is stored in the ArPackageIndexCache along with the opened archive, where
+/// both are reused until the archive's modification timestamp changes. This
+/// allows files in the same archive to be opened without opening the
+/// archive again. Within a scoped cache, the timestamp is only checked the
+/// first time an archive is accessed.
+///
+/// Members that are stored without compression are opened as assets that
+/// refer directly into the archive's contents, so their contents are never
+/// copied. Members compressed with the deflate method are decompressed into
+/// an ArInMemoryAsset when opened; this requires Ar to be built with the
+/// ENABLE_ZLIB option. Other compression methods and encrypted members are
+/// not supported.
+class ArZipPackageResolver
+    : public ArPackageResolver
+{
+public:
+    AR_API
+    ArZipPackageResolver();
+
+    AR_API
+    virtual ~ArZipPackageResolver();
+
+    /// Returns \p packagedPath if the archive at \p resolvedPackagePath
+    /// contains a file at that path, otherwise returns an empty string.
+    AR_API
+    virtual std::string Resolve(
+        const std::string& resolvedPackagePath,
+        const std::string& packagedPath) override;
+
+    /// Returns an ArAsset for the file at \p resolvedPackagedPath in the
+    /// archive at \p resolvedPackagePath.
+    AR_API
+    virtual std::shared_ptr<ArAsset> OpenAsset(
+        const std::string& resolvedPackagePath,
+        const std::string& resolvedPackagedPath) override;
+
+    /// Returns ArAsset objects for the files at \p resolvedPackagedPaths in
+    /// the archive at \p resolvedPackagePath. The files are read in the
+    /// order they are stored in the archive.
+    AR_API
+    virtual std::vector<std::shared_ptr<ArAsset>> OpenAssets(
+        const std::string& resolvedPackagePath,
+        const std::vector<std::string>& resolvedPackagedPaths) override;
+
+    AR_API
+    virtual void BeginCacheScope(
+        VtValue* cacheScopeData) override;
+
+    AR_API
+    virtual void EndCacheScope(
+        VtValue* cacheScopeData) override;
+
+private:
+    ArPackageIndexCache::IndexConstPtr _GetIndex(
+        const std::string& resolvedPackagePath);
+
+    // Opens the file described by \p member in the archive described by
+    // \p index.
+    std::shared_ptr<ArAsset> _OpenMember(
+        const std::string& resolvedPackagePath,
+        const std::string& resolvedPackagedPath,
+        const ArPackageIndexCache::Member& member,
+        const ArPackageIndexCache::Index& index);
+
+    struct _Cache
+    {
+        std::mutex mutex;
+        std::unordered_map<std::string, ArPackageIndexCache::IndexConstPtr>
+            indexes;
+    };
+
+    using _PerThreadCache = ArThreadLocalScopedCache<_Cache>;
+    _PerThreadCache _threadCache;
+};
+
+}  // namespace pxr
+
+#endif // PXR_AR_ZIP_PACKAGE_RESOLVER_H
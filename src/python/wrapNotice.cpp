@@ -8,9 +8,11 @@
 #include <pxr/ar/notice.h>
 
 #include <pxr/tf/pyNoticeWrapper.h>
+#include <pxr/tf/pyResultConversions.h>
 
 #include <pxr/boost/python/scope.hpp>
 #include <pxr/boost/python/class.hpp>
+#include <pxr/boost/python/return_value_policy.hpp>
 
 using namespace pxr;
 
@@ -37,5 +39,18 @@ wrapNotice()
         ArNotice::ResolverChanged, ArNotice::ResolverNotice>::Wrap()
         .def("AffectsContext", &ArNotice::ResolverChanged::AffectsContext,
              args("context"))
+        .def("AffectsAllAssetPaths",
+             &ArNotice::ResolverChanged::AffectsAllAssetPaths)
+        .def("GetChangedAssetPaths",
+             &ArNotice::ResolverChanged::GetChangedAssetPaths,
+             return_value_policy<TfPySequenceToList>())
+        .def("GetChangedPrefixes",
+             &ArNotice::ResolverChanged::GetChangedPrefixes,
+             return_value_policy<TfPySequenceToList>())
+        .def("AffectsAssetPath",
+             &ArNotice::ResolverChanged::AffectsAssetPath,
+             args("assetPath"))
+        .def("AffectsPrefix", &ArNotice::ResolverChanged::AffectsPrefix,
+             args("prefix"))
         ;
 }
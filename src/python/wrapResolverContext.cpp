@@ -75,8 +75,10 @@ public:
     static pxr::boost::python::list GetAsList(const ArResolverContext& ctx)
     {
         pxr::boost::python::list l;
-        for (const auto& data : ctx._contexts) {
-            l.append(data->GetPythonObj().Get());
+        if (ctx._data) {
+            for (const auto& data : ctx._data->contexts) {
+                l.append(data->GetPythonObj().Get());
+            }
         }
         return l;
     }
@@ -84,8 +86,11 @@ public:
     static std::string GetRepr(const ArResolverContext& ctx)
     {
         std::vector<std::string> objReprs;
-        for (const auto& data : ctx._contexts) {
-            objReprs.push_back(TfPyObjectRepr(data->GetPythonObj().Get()));
+        if (ctx._data) {
+            for (const auto& data : ctx._data->contexts) {
+                objReprs.push_back(
+                    TfPyObjectRepr(data->GetPythonObj().Get()));
+            }
         }
         return TF_PY_REPR_PREFIX +
             TfStringPrintf("ResolverContext(%s)", 
@@ -5,16 +5,66 @@
 //
 // Modified by Jeremy Retailleau.
 
+#include "plugin.h"
+
 #include <pxr/ar/definePackageResolver.h>
 #include <pxr/ar/packageResolver.h>
+#include <pxr/ar/packageUtils.h>
 
 #include <pxr/tf/diagnosticLite.h>
+#include <pxr/tf/pathUtils.h>
 #include <pxr/tf/stringUtils.h>
 
+#include <mutex>
+
 using namespace pxr;
 
+static std::mutex _callsMutex;
+static std::vector<_TestPackageResolverCall> _resolveCalls;
+static std::vector<_TestPackageResolverCall> _openAssetCalls;
+
+namespace pxr {
+
+std::vector<_TestPackageResolverCall>
+_TestPackageResolverGetResolveCalls()
+{
+    std::lock_guard<std::mutex> lock(_callsMutex);
+    return _resolveCalls;
+}
+
+std::vector<_TestPackageResolverCall>
+_TestPackageResolverGetOpenAssetCalls()
+{
+    std::lock_guard<std::mutex> lock(_callsMutex);
+    return _openAssetCalls;
+}
+
+void
+_TestPackageResolverClearCalls()
+{
+    std::lock_guard<std::mutex> lock(_callsMutex);
+    _resolveCalls.clear();
+    _openAssetCalls.clear();
+}
+
+}  // namespace pxr
+
+// Returns true if \p resolvedPackagePath refers to a package handled by
+// _TestPackageResolver. The package may itself be nested in another
+// package, in which case the innermost packaged path determines its format.
+static bool
+_IsTestPackage(const std::string& resolvedPackagePath)
+{
+    const std::string packagePath =
+        ArIsPackageRelativePath(resolvedPackagePath) ?
+        ArSplitPackageRelativePathInner(resolvedPackagePath).second :
+        resolvedPackagePath;
+    return TfStringToLowerAscii(TfGetExtension(packagePath)) == "package";
+}
+
 // Test package resolver that handles packages of the form
-// "foo.package[...]"
+// "foo.package[...]". Every packaged path is assumed to exist, and calls
+// are recorded so tests can check which resolver handled a given path.
 class _TestPackageResolver
     : public ArPackageResolver
 {
@@ -23,7 +73,10 @@ public:
         const std::string& resolvedPackagePath,
         const std::string& packagedPath) override
     {
-        TF_AXIOM(TfStringEndsWith(resolvedPackagePath, ".package"));
+        TF_AXIOM(_IsTestPackage(resolvedPackagePath));
+
+        std::lock_guard<std::mutex> lock(_callsMutex);
+        _resolveCalls.emplace_back(resolvedPackagePath, packagedPath);
         return packagedPath;
     }
 
@@ -31,6 +84,11 @@ public:
         const std::string& resolvedPackagePath,
         const std::string& resolvedPackagedPath) override
     {
+        TF_AXIOM(_IsTestPackage(resolvedPackagePath));
+
+        std::lock_guard<std::mutex> lock(_callsMutex);
+        _openAssetCalls.emplace_back(
+            resolvedPackagePath, resolvedPackagedPath);
         return nullptr;
     }
 
@@ -0,0 +1,43 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#ifndef PXR_AR_TEST_PACKAGE_RESOLVER_PLUGIN_H
+#define PXR_AR_TEST_PACKAGE_RESOLVER_PLUGIN_H
+
+#include <pxr/arch/export.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(TestArPackageResolver_EXPORTS)
+#   define TEST_AR_PACKAGE_RESOLVER_API ARCH_EXPORT
+#else
+#   define TEST_AR_PACKAGE_RESOLVER_API ARCH_IMPORT
+#endif
+
+namespace pxr {
+
+// The (resolvedPackagePath, packagedPath) arguments given to a call to
+// _TestPackageResolver.
+using _TestPackageResolverCall = std::pair<std::string, std::string>;
+
+// Returns the arguments of each call to _TestPackageResolver::Resolve since
+// the last call to _TestPackageResolverClearCalls.
+TEST_AR_PACKAGE_RESOLVER_API
+std::vector<_TestPackageResolverCall> _TestPackageResolverGetResolveCalls();
+
+// Returns the arguments of each call to _TestPackageResolver::OpenAsset
+// since the last call to _TestPackageResolverClearCalls.
+TEST_AR_PACKAGE_RESOLVER_API
+std::vector<_TestPackageResolverCall> _TestPackageResolverGetOpenAssetCalls();
+
+// Clears the calls recorded by _TestPackageResolver.
+TEST_AR_PACKAGE_RESOLVER_API
+void _TestPackageResolverClearCalls();
+
+}  // namespace pxr
+
+#endif // PXR_AR_TEST_PACKAGE_RESOLVER_PLUGIN_H
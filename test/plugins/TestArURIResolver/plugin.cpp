@@ -10,18 +10,62 @@
 #include <pxr/ar/defaultResolver.h>
 #include <pxr/ar/defineResolver.h>
 #include <pxr/ar/defineResolverContext.h>
+#include <pxr/ar/inMemoryAsset.h>
+#include <pxr/ar/writableAsset.h>
 
 #include <pxr/tf/diagnosticLite.h>
 #include <pxr/tf/pathUtils.h>
 #include <pxr/tf/stringUtils.h>
 #include <pxr/vt/value.h>
 
+#include <cstring>
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
 using namespace pxr;
 
+// Contents of assets written through the test URI resolvers, keyed by
+// resolved path. This allows tests to copy assets between these resolvers
+// and the filesystem.
+static std::mutex _assetsMutex;
+static std::map<std::string, std::string> _assets;
+
+// Writable asset that stores its contents in _assets when closed.
+class _TestURIWritableAsset
+    : public ArWritableAsset
+{
+public:
+    _TestURIWritableAsset(
+        const std::string& resolvedPath,
+        std::string contents)
+        : _resolvedPath(resolvedPath)
+        , _contents(std::move(contents))
+    {
+    }
+
+    bool Close() override
+    {
+        std::lock_guard<std::mutex> lock(_assetsMutex);
+        _assets[_resolvedPath] = _contents;
+        return true;
+    }
+
+    size_t Write(const void* buffer, size_t count, size_t offset) override
+    {
+        if (_contents.size() < offset + count) {
+            _contents.resize(offset + count);
+        }
+        memcpy(&_contents[offset], buffer, count);
+        return count;
+    }
+
+private:
+    std::string _resolvedPath;
+    std::string _contents;
+};
+
 // Base class for test URI resolvers
 class _TestURIResolverBase
     : public ArResolver
@@ -92,7 +136,19 @@ protected:
     {
         TF_AXIOM(TfStringStartsWith(TfStringToLowerAscii(resolvedPath),
                                     _uriScheme));
-        return nullptr;
+
+        std::lock_guard<std::mutex> lock(_assetsMutex);
+        const auto it = _assets.find(resolvedPath);
+        if (it == _assets.end()) {
+            return nullptr;
+        }
+
+        std::shared_ptr<char> buffer(
+            new char[it->second.size()], std::default_delete<char[]>());
+        memcpy(buffer.get(), it->second.data(), it->second.size());
+        return ArInMemoryAsset::FromBuffer(
+            std::shared_ptr<const char>(std::move(buffer)),
+            it->second.size());
     }
 
     ArResolverContext _CreateContextFromString(
@@ -108,7 +164,18 @@ protected:
     {
         TF_AXIOM(TfStringStartsWith(TfStringToLowerAscii(resolvedPath),
                                     _uriScheme));
-        return nullptr;
+
+        std::string contents;
+        if (writeMode == WriteMode::Update) {
+            std::lock_guard<std::mutex> lock(_assetsMutex);
+            const auto it = _assets.find(resolvedPath);
+            if (it != _assets.end()) {
+                contents = it->second;
+            }
+        }
+
+        return std::make_shared<_TestURIWritableAsset>(
+            resolvedPath, std::move(contents));
     }
 
 private:
@@ -6,13 +6,29 @@
 // Modified by Jeremy Retailleau.
 
 #include <pxr/ar/asset.h>
+#include <pxr/ar/defaultResolver.h>
+#include <pxr/ar/defaultResolverContext.h>
 #include <pxr/ar/filesystemAsset.h>
+#include <pxr/ar/packageUtils.h>
 #include <pxr/ar/resolvedPath.h>
 #include <pxr/ar/resolver.h>
+#include <pxr/ar/resolverContext.h>
+#include <pxr/ar/resolverContextBinder.h>
+#include <pxr/ar/writableAsset.h>
 #include <pxr/tf/diagnostic.h>
+#include <pxr/tf/errorMark.h>
+#include <pxr/tf/fileUtils.h>
+#include <pxr/tf/getenv.h>
+#include <pxr/tf/stringUtils.h>
 #include <pxr/arch/fileSystem.h>
 #include <pxr/arch/systemInfo.h>
 
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
 using namespace pxr;
 
 static void
@@ -63,6 +79,544 @@ TestOpenAsset()
     ArchUnlinkFile(tmpPath.c_str());
 }
 
+static void
+TestWritableAssetReserve()
+{
+    std::string tmpPath;
+    int fd = ArchMakeTmpFile(
+        ArchGetCwd(), "testArDefaultResolver_CPP_Reserve", &tmpPath);
+    TF_AXIOM(fd != -1);
+
+    FILE* tmpFile = ArchFdOpen(fd, "w");
+    TF_AXIOM(tmpFile);
+    fclose(tmpFile);
+
+    std::shared_ptr<ArWritableAsset> asset = ArGetResolver().OpenAssetForWrite(
+        ArResolvedPath(tmpPath), ArResolver::WriteMode::Replace);
+    TF_AXIOM(asset);
+
+    // Reserve is only a hint, so we don't require it to succeed. Whether or
+    // not it does, the reserved space must not be visible after writing
+    // fewer bytes than were reserved.
+    asset->Reserve(1024 * 1024);
+
+    const std::string contents = 
+        "Test file generated by testArDefaultResolver_CPP";
+    TF_AXIOM(asset->Write(contents.c_str(), contents.length(), 0) ==
+        contents.length());
+    TF_AXIOM(asset->Close());
+
+    TF_AXIOM(static_cast<size_t>(ArchGetFileLength(tmpPath.c_str())) ==
+        contents.length());
+
+    std::shared_ptr<ArAsset> readAsset =
+        ArGetResolver().OpenAsset(ArResolvedPath(tmpPath));
+    TF_AXIOM(readAsset);
+    TF_AXIOM(readAsset->GetSize() == contents.length());
+
+    std::shared_ptr<const char> buffer = readAsset->GetBuffer();
+    TF_AXIOM(std::string(buffer.get(), readAsset->GetSize()) == contents);
+
+    readAsset.reset();
+    ArchUnlinkFile(tmpPath.c_str());
+}
+
+static std::string
+_ReadAsset(const std::string& path)
+{
+    std::shared_ptr<ArAsset> asset =
+        ArGetResolver().OpenAsset(ArResolvedPath(path));
+    TF_AXIOM(asset);
+
+    std::shared_ptr<const char> buffer = asset->GetBuffer();
+    TF_AXIOM(buffer);
+    return std::string(buffer.get(), asset->GetSize());
+}
+
+static void
+TestCopyAsset()
+{
+    const std::string tmpDir =
+        ArchMakeTmpSubdir(ArchGetCwd(), "testArDefaultResolver_CPP_Copy");
+    TF_AXIOM(!tmpDir.empty());
+
+    // Use contents larger than the buffers used by ArFilesystemWritableAsset
+    // and ArResolver when copying through memory (1 MiB and 8 MiB) to
+    // exercise copies that take multiple iterations.
+    std::string contents;
+    for (size_t i = 0; contents.size() < 9 * 1024 * 1024; ++i) {
+        contents += TfStringPrintf("line %zu\n", i);
+    }
+
+    const std::string srcPath = tmpDir + "/src.txt";
+    {
+        std::shared_ptr<ArWritableAsset> asset =
+            ArGetResolver().OpenAssetForWrite(
+                ArResolvedPath(srcPath), ArResolver::WriteMode::Replace);
+        TF_AXIOM(asset);
+        TF_AXIOM(asset->Write(contents.c_str(), contents.size(), 0) ==
+            contents.size());
+        TF_AXIOM(asset->Close());
+    }
+
+    // Copying into a directory that doesn't exist yet should create it.
+    const std::string dstPath = tmpDir + "/sub/dir/dst.txt";
+    TF_AXIOM(ArGetResolver().CopyAsset(
+        ArResolvedPath(srcPath), ArResolvedPath(dstPath),
+        ArResolver::WriteMode::Replace));
+    TF_AXIOM(_ReadAsset(dstPath) == contents);
+
+    // Copying over an existing asset in Replace mode discards its previous
+    // contents.
+    const std::string smallPath = tmpDir + "/small.txt";
+    {
+        std::shared_ptr<ArWritableAsset> asset =
+            ArGetResolver().OpenAssetForWrite(
+                ArResolvedPath(smallPath), ArResolver::WriteMode::Replace);
+        TF_AXIOM(asset);
+        TF_AXIOM(asset->Write("small", 5, 0) == 5);
+        TF_AXIOM(asset->Close());
+    }
+
+    TF_AXIOM(ArGetResolver().CopyAsset(
+        ArResolvedPath(smallPath), ArResolvedPath(dstPath),
+        ArResolver::WriteMode::Replace));
+    TF_AXIOM(_ReadAsset(dstPath) == "small");
+
+    // Copying in Update mode overwrites the existing contents in place.
+    TF_AXIOM(ArGetResolver().CopyAsset(
+        ArResolvedPath(srcPath), ArResolvedPath(dstPath),
+        ArResolver::WriteMode::Update));
+    TF_AXIOM(_ReadAsset(dstPath) == contents);
+
+    // Copying a nonexistent asset fails.
+    {
+        TfErrorMark m;
+        TF_AXIOM(!ArGetResolver().CopyAsset(
+            ArResolvedPath(tmpDir + "/bogus.txt"), ArResolvedPath(dstPath),
+            ArResolver::WriteMode::Replace));
+        TF_AXIOM(!m.IsClean());
+        m.Clear();
+    }
+    TF_AXIOM(_ReadAsset(dstPath) == contents);
+
+    TfRmTree(tmpDir);
+}
+
+static void
+_WriteAsset(const std::string& path, const std::string& contents)
+{
+    std::shared_ptr<ArWritableAsset> asset =
+        ArGetResolver().OpenAssetForWrite(
+            ArResolvedPath(path), ArResolver::WriteMode::Replace);
+    TF_AXIOM(asset);
+    TF_AXIOM(asset->Write(contents.c_str(), contents.size(), 0) ==
+        contents.size());
+    TF_AXIOM(asset->Close());
+}
+
+static void
+TestWriteAssetsToRemovedDirectory()
+{
+    const std::string tmpDir =
+        ArchMakeTmpSubdir(ArchGetCwd(), "testArDefaultResolver_CPP_Dirs");
+    TF_AXIOM(!tmpDir.empty());
+
+    // Write many assets into the same directory, which only needs to be
+    // looked up on disk for the first one.
+    const std::string assetDir = tmpDir + "/a/b/c";
+    for (size_t i = 0; i < 100; ++i) {
+        const std::string path = TfStringPrintf(
+            "%s/asset_%zu.txt", assetDir.c_str(), i);
+        _WriteAsset(path, path);
+    }
+    for (size_t i = 0; i < 100; ++i) {
+        const std::string path = TfStringPrintf(
+            "%s/asset_%zu.txt", assetDir.c_str(), i);
+        TF_AXIOM(_ReadAsset(path) == path);
+    }
+
+    // Removing the directory behind the resolver's back must not cause
+    // later writes into it to fail; the directory should be recreated.
+    TfRmTree(tmpDir + "/a");
+    TF_AXIOM(!TfIsDir(assetDir));
+
+    {
+        TfErrorMark m;
+        const std::string path = assetDir + "/recreated.txt";
+        _WriteAsset(path, "recreated");
+        TF_AXIOM(m.IsClean());
+        TF_AXIOM(_ReadAsset(path) == "recreated");
+    }
+
+    TfRmTree(tmpDir);
+}
+
+static void
+TestWriteRanges()
+{
+    const std::string tmpDir =
+        ArchMakeTmpSubdir(ArchGetCwd(), "testArDefaultResolver_CPP_Ranges");
+    TF_AXIOM(!tmpDir.empty());
+
+    const std::string header = "HEADER";
+    const std::string index = "INDEX";
+    const std::string payload(100000, 'p');
+    const std::string footer = "FOOTER";
+
+    // Adjacent requests, an empty request, and a request that leaves a gap
+    // at the front of the file that is filled in by a later request.
+    const size_t payloadOffset = header.size() + index.size() + 10;
+    const std::vector<ArWritableAsset::WriteRequest> requests = {
+        { payload.data(), payload.size(), payloadOffset },
+        { footer.data(), footer.size(), payloadOffset + payload.size() },
+        { nullptr, 0, 0 },
+        { header.data(), header.size(), 0 },
+        { index.data(), index.size(), header.size() },
+        { "0123456789", 10, header.size() + index.size() },
+    };
+
+    const size_t expectedSize = payloadOffset + payload.size() + footer.size();
+    const std::string expected =
+        header + index + "0123456789" + payload + footer;
+    TF_AXIOM(expected.size() == expectedSize);
+
+    const std::string path = tmpDir + "/ranges.bin";
+    for (ArResolver::WriteMode writeMode : {
+            ArResolver::WriteMode::Replace, ArResolver::WriteMode::Update }) {
+        std::shared_ptr<ArWritableAsset> asset =
+            ArGetResolver().OpenAssetForWrite(
+                ArResolvedPath(path), writeMode);
+        TF_AXIOM(asset);
+        TF_AXIOM(asset->WriteRanges(requests.data(), requests.size()) ==
+            expectedSize);
+        TF_AXIOM(asset->WriteRanges(nullptr, 0) == 0);
+        TF_AXIOM(asset->Close());
+
+        TF_AXIOM(_ReadAsset(path) == expected);
+    }
+
+    TfRmTree(tmpDir);
+}
+
+static void
+_AppendU16(std::string* s, uint16_t v)
+{
+    s->push_back(char(v & 0xFF));
+    s->push_back(char(v >> 8));
+}
+
+static void
+_AppendU32(std::string* s, uint32_t v)
+{
+    _AppendU16(s, uint16_t(v & 0xFFFF));
+    _AppendU16(s, uint16_t(v >> 16));
+}
+
+// Writes a zip archive at \p path containing the given files, stored
+// without compression. Checksums are left empty since they are not used
+// when reading stored files.
+static void
+_WriteStoredZip(
+    const std::string& path,
+    const std::vector<std::pair<std::string, std::string>>& files)
+{
+    std::string archive, centralDir;
+    for (const auto& file : files) {
+        const uint32_t localHeaderOffset = uint32_t(archive.size());
+        const uint32_t size = uint32_t(file.second.size());
+        const uint16_t nameLength = uint16_t(file.first.size());
+
+        _AppendU32(&archive, 0x04034b50);
+        _AppendU16(&archive, 10);  // version needed
+        _AppendU16(&archive, 0);   // flags
+        _AppendU16(&archive, 0);   // method
+        _AppendU32(&archive, 0);   // modification time and date
+        _AppendU32(&archive, 0);   // crc
+        _AppendU32(&archive, size);
+        _AppendU32(&archive, size);
+        _AppendU16(&archive, nameLength);
+        _AppendU16(&archive, 0);   // extra field length
+        archive += file.first;
+        archive += file.second;
+
+        _AppendU32(&centralDir, 0x02014b50);
+        _AppendU16(&centralDir, 10);  // version made by
+        _AppendU16(&centralDir, 10);  // version needed
+        _AppendU16(&centralDir, 0);   // flags
+        _AppendU16(&centralDir, 0);   // method
+        _AppendU32(&centralDir, 0);   // modification time and date
+        _AppendU32(&centralDir, 0);   // crc
+        _AppendU32(&centralDir, size);
+        _AppendU32(&centralDir, size);
+        _AppendU16(&centralDir, nameLength);
+        _AppendU16(&centralDir, 0);   // extra field length
+        _AppendU16(&centralDir, 0);   // comment length
+        _AppendU16(&centralDir, 0);   // disk number
+        _AppendU16(&centralDir, 0);   // internal attributes
+        _AppendU32(&centralDir, 0);   // external attributes
+        _AppendU32(&centralDir, localHeaderOffset);
+        centralDir += file.first;
+    }
+
+    const uint32_t centralDirOffset = uint32_t(archive.size());
+    archive += centralDir;
+
+    _AppendU32(&archive, 0x06054b50);
+    _AppendU16(&archive, 0);  // disk number
+    _AppendU16(&archive, 0);  // disk with central directory
+    _AppendU16(&archive, uint16_t(files.size()));
+    _AppendU16(&archive, uint16_t(files.size()));
+    _AppendU32(&archive, uint32_t(centralDir.size()));
+    _AppendU32(&archive, centralDirOffset);
+    _AppendU16(&archive, 0);  // comment length
+
+    _WriteAsset(path, archive);
+}
+
+static void
+TestOpenAssets()
+{
+    const std::string tmpDir =
+        ArchMakeTmpSubdir(ArchGetCwd(), "testArDefaultResolver_CPP_Bulk");
+    TF_AXIOM(!tmpDir.empty());
+
+    const std::string fileA = tmpDir + "/a.txt";
+    const std::string fileB = tmpDir + "/b.txt";
+    const std::string archive = tmpDir + "/archive.zip";
+    _WriteAsset(fileA, "contents of a");
+    _WriteAsset(fileB, "contents of b");
+    _WriteStoredZip(archive, {
+        { "first.txt", "first member" },
+        { "dir/second.txt", "second member" },
+        { "third.txt", "third member" },
+    });
+
+    // Mix files on disk with files in the archive, requesting the archive's
+    // files in a different order than they are stored and including paths
+    // that don't exist.
+    const std::vector<ArResolvedPath> paths = {
+        ArResolvedPath(ArJoinPackageRelativePath(archive, "third.txt")),
+        ArResolvedPath(fileA),
+        ArResolvedPath(ArJoinPackageRelativePath(archive, "missing.txt")),
+        ArResolvedPath(ArJoinPackageRelativePath(archive, "first.txt")),
+        ArResolvedPath(tmpDir + "/missing.txt"),
+        ArResolvedPath(ArJoinPackageRelativePath(archive, "dir/second.txt")),
+        ArResolvedPath(fileB),
+    };
+    const std::vector<std::string> expected = {
+        "third member",
+        "contents of a",
+        "",
+        "first member",
+        "",
+        "second member",
+        "contents of b",
+    };
+
+    const std::vector<std::shared_ptr<ArAsset>> assets =
+        ArGetResolver().OpenAssets(paths);
+    TF_AXIOM(assets.size() == paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        if (expected[i].empty()) {
+            TF_AXIOM(!assets[i]);
+            continue;
+        }
+
+        TF_AXIOM(assets[i]);
+        TF_AXIOM(assets[i]->GetSize() == expected[i].size());
+        TF_AXIOM(std::string(assets[i]->GetBuffer().get(),
+                             assets[i]->GetSize()) == expected[i]);
+
+        // Each asset must match what OpenAsset returns for the same path.
+        TF_AXIOM(_ReadAsset(paths[i].GetPathString()) == expected[i]);
+    }
+
+    TF_AXIOM(ArGetResolver().OpenAssets({}).empty());
+
+    TfRmTree(tmpDir);
+}
+
+static void
+TestContexts()
+{
+    const std::string cwd = ArchGetCwd();
+
+    // Equal search paths compare and hash equal whether or not they needed
+    // to be normalized.
+    const ArDefaultResolverContext ctx({cwd, "/tmp"});
+    TF_AXIOM(ctx == ArDefaultResolverContext({cwd, "/tmp"}));
+    TF_AXIOM(ctx == ArDefaultResolverContext({cwd + "/./", "/tmp/"}));
+    TF_AXIOM(ctx == ArDefaultResolverContext({".", "/tmp"}));
+    TF_AXIOM(hash_value(ctx) ==
+        hash_value(ArDefaultResolverContext({".", "/tmp"})));
+    TF_AXIOM(ctx.GetSearchPath() ==
+        std::vector<std::string>({TfAbsPath(cwd), "/tmp"}));
+
+    TF_AXIOM(ctx != ArDefaultResolverContext({"/tmp", cwd}));
+    TF_AXIOM(ArDefaultResolverContext({""}) == ArDefaultResolverContext());
+    TF_AXIOM(ArDefaultResolverContext().GetSearchPath().empty());
+
+    // Contexts created from the same string are equal, including when they
+    // are returned from the resolver's cache.
+    const std::string contextStr = TfStringJoin(
+        std::vector<std::string>({cwd, "/tmp"}), ARCH_PATH_LIST_SEP);
+    const ArResolverContext fromString =
+        ArGetResolver().CreateContextFromString(contextStr);
+    TF_AXIOM(fromString == ArResolverContext(ctx));
+    TF_AXIOM(fromString ==
+        ArGetResolver().CreateContextFromString(contextStr));
+
+    // The default context for an asset searches the asset's directory.
+    const ArResolverContext forAsset =
+        ArGetResolver().CreateDefaultContextForAsset(cwd + "/a/b.txt");
+    TF_AXIOM(forAsset == ArResolverContext(
+        ArDefaultResolverContext({cwd + "/a"})));
+}
+
+static void
+TestSetDefaultSearchPathConcurrently()
+{
+    const std::string tmpDir = ArchMakeTmpSubdir(
+        ArchGetCwd(), "testArDefaultResolver_CPP_SearchPath");
+    TF_AXIOM(!tmpDir.empty());
+
+    const std::string assetPath = "searchPathAsset.txt";
+    const std::string dirA = tmpDir + "/a", dirB = tmpDir + "/b";
+    _WriteAsset(dirA + "/" + assetPath, "a");
+    _WriteAsset(dirB + "/" + assetPath, "b");
+
+    ArDefaultResolver::SetDefaultSearchPath({dirA});
+
+    // Changing the default search path while other threads resolve must
+    // always give them one of the search paths, never a partial one.
+    std::atomic<bool> done(false);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; ++i) {
+        threads.emplace_back([&]() {
+            while (!done) {
+                const ArResolvedPath resolvedPath =
+                    ArGetResolver().Resolve(assetPath);
+                TF_AXIOM(
+                    resolvedPath.GetPathString() == dirA + "/" + assetPath ||
+                    resolvedPath.GetPathString() == dirB + "/" + assetPath);
+            }
+        });
+    }
+
+    for (size_t i = 0; i < 1000; ++i) {
+        ArDefaultResolver::SetDefaultSearchPath({i % 2 ? dirA : dirB});
+    }
+    done = true;
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    // The last search path set is visible to every thread.
+    ArDefaultResolver::SetDefaultSearchPath({dirB});
+    TF_AXIOM(ArGetResolver().Resolve(assetPath) ==
+        ArResolvedPath(dirB + "/" + assetPath));
+    std::thread([&]() {
+        TF_AXIOM(ArGetResolver().Resolve(assetPath) ==
+            ArResolvedPath(dirB + "/" + assetPath));
+    }).join();
+
+    ArDefaultResolver::SetDefaultSearchPath({});
+    TF_AXIOM(!ArGetResolver().Resolve(assetPath));
+
+    TfRmTree(tmpDir);
+}
+
+static void
+TestResolveCache()
+{
+    // This test also runs with PXR_AR_DEFAULT_RESOLVER_CACHE enabled.
+    const bool cacheEnabled =
+        TfGetenvBool("PXR_AR_DEFAULT_RESOLVER_CACHE", false);
+
+    const std::string tmpDir = ArchMakeTmpSubdir(
+        ArchGetCwd(), "testArDefaultResolver_CPP_Cache");
+    TF_AXIOM(!tmpDir.empty());
+
+    const std::string assetPath = "resolveCacheAsset.txt";
+    const ArResolvedPath expected(tmpDir + "/" + assetPath);
+
+    const ArResolverContext ctx(ArDefaultResolverContext({tmpDir}));
+    {
+        ArResolverContextBinder binder(ctx);
+        TF_AXIOM(!ArGetResolver().Resolve(assetPath));
+    }
+
+    // An asset added to the search path is only found after refreshing
+    // the context when results are cached.
+    _WriteAsset(expected.GetPathString(), "contents");
+    {
+        ArResolverContextBinder binder(ctx);
+        TF_AXIOM(ArGetResolver().Resolve(assetPath) ==
+            (cacheEnabled ? ArResolvedPath() : expected));
+    }
+
+    ArGetResolver().RefreshContext(ctx);
+    {
+        ArResolverContextBinder binder(ctx);
+        TF_AXIOM(ArGetResolver().Resolve(assetPath) == expected);
+    }
+
+    // Other contexts with the same search path share the cached results.
+    ArchUnlinkFile(expected.GetPathString().c_str());
+    {
+        ArResolverContextBinder binder(
+            ArResolverContext(ArDefaultResolverContext({tmpDir})));
+        TF_AXIOM(ArGetResolver().Resolve(assetPath) ==
+            (cacheEnabled ? expected : ArResolvedPath()));
+    }
+
+    ArGetResolver().RefreshContext(ctx);
+    {
+        ArResolverContextBinder binder(ctx);
+        TF_AXIOM(!ArGetResolver().Resolve(assetPath));
+    }
+
+    TfRmTree(tmpDir);
+}
+
+static void
+TestResolveCacheLimit()
+{
+    // This test also runs with PXR_AR_DEFAULT_RESOLVER_CACHE enabled, both
+    // with the default cache size and with a cache size small enough that
+    // resolving many paths evicts earlier results.
+    const bool cacheEnabled =
+        TfGetenvBool("PXR_AR_DEFAULT_RESOLVER_CACHE", false);
+    const int cacheSize =
+        TfGetenvInt("PXR_AR_DEFAULT_RESOLVER_CACHE_SIZE", 65536);
+
+    const std::string tmpDir = ArchMakeTmpSubdir(
+        ArchGetCwd(), "testArDefaultResolver_CPP_CacheLimit");
+    TF_AXIOM(!tmpDir.empty());
+
+    const std::string assetPath = "resolveCacheLimitAsset.txt";
+    const ArResolvedPath expected(tmpDir + "/" + assetPath);
+    _WriteAsset(expected.GetPathString(), "contents");
+
+    ArResolverContextBinder binder(
+        ArResolverContext(ArDefaultResolverContext({tmpDir})));
+    TF_AXIOM(ArGetResolver().Resolve(assetPath) == expected);
+    ArchUnlinkFile(expected.GetPathString().c_str());
+
+    // Paths that fail to resolve take up space in the cache as well.
+    const int numPaths = 1000;
+    for (int i = 0; i < numPaths; ++i) {
+        TF_AXIOM(!ArGetResolver().Resolve(
+            TfStringPrintf("missing_%d.txt", i)));
+    }
+
+    TF_AXIOM(ArGetResolver().Resolve(assetPath) ==
+        (cacheEnabled && cacheSize > numPaths ? expected : ArResolvedPath()));
+
+    TfRmTree(tmpDir);
+}
+
 int main(int argc, char** argv)
 {
     // Set the preferred resolver to ArDefaultResolver before
@@ -72,6 +626,33 @@ int main(int argc, char** argv)
     printf("TestOpenAsset...\n");
     TestOpenAsset();
 
+    printf("TestWritableAssetReserve...\n");
+    TestWritableAssetReserve();
+
+    printf("TestCopyAsset...\n");
+    TestCopyAsset();
+
+    printf("TestWriteAssetsToRemovedDirectory...\n");
+    TestWriteAssetsToRemovedDirectory();
+
+    printf("TestWriteRanges...\n");
+    TestWriteRanges();
+
+    printf("TestOpenAssets...\n");
+    TestOpenAssets();
+
+    printf("TestContexts...\n");
+    TestContexts();
+
+    printf("TestSetDefaultSearchPathConcurrently...\n");
+    TestSetDefaultSearchPathConcurrently();
+
+    printf("TestResolveCache...\n");
+    TestResolveCache();
+
+    printf("TestResolveCacheLimit...\n");
+    TestResolveCacheLimit();
+
     printf("Passed!\n");
 
     return EXIT_SUCCESS;;
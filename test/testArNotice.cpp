@@ -10,6 +10,8 @@
 #include <pxr/ar/resolverContext.h>
 
 #include <cstdio>
+#include <string>
+#include <vector>
 
 using namespace pxr;
 
@@ -84,9 +86,84 @@ TestResolverChangedNotice()
             ArResolverContext(IntContext(0), StringContext("test-needle"))));
 }
 
+static void
+TestResolverChangedNoticePaths()
+{
+    ArNotice::ResolverChanged affectsAllNotice;
+    TF_AXIOM(affectsAllNotice.AffectsAllAssetPaths());
+    TF_AXIOM(affectsAllNotice.AffectsAssetPath("/a/b.usd"));
+    TF_AXIOM(affectsAllNotice.AffectsPrefix("/a"));
+
+    ArNotice::ResolverChanged notice;
+    notice.AddChangedAssetPath("/a/b/c.usd");
+    notice.AddChangedPrefix("/d/e/");
+    TF_AXIOM(!notice.AffectsAllAssetPaths());
+    TF_AXIOM(notice.GetChangedAssetPaths() ==
+        std::vector<std::string>({"/a/b/c.usd"}));
+    TF_AXIOM(notice.GetChangedPrefixes() ==
+        std::vector<std::string>({"/d/e"}));
+
+    // Restricting paths doesn't change the affected contexts.
+    TF_AXIOM(notice.AffectsContext(ArResolverContext()));
+
+    TF_AXIOM(notice.AffectsAssetPath("/a/b/c.usd"));
+    TF_AXIOM(!notice.AffectsAssetPath("/a/b/c.usda"));
+    TF_AXIOM(!notice.AffectsAssetPath("/a/b"));
+    TF_AXIOM(notice.AffectsAssetPath("/d/e"));
+    TF_AXIOM(notice.AffectsAssetPath("/d/e/f/g.usd"));
+    TF_AXIOM(!notice.AffectsAssetPath("/d/ef/g.usd"));
+    TF_AXIOM(!notice.AffectsAssetPath("/d"));
+
+    TF_AXIOM(notice.AffectsPrefix("/"));
+    TF_AXIOM(notice.AffectsPrefix("/a"));
+    TF_AXIOM(notice.AffectsPrefix("/a/b/"));
+    TF_AXIOM(!notice.AffectsPrefix("/a/bb"));
+    TF_AXIOM(notice.AffectsPrefix("/d"));
+    TF_AXIOM(notice.AffectsPrefix("/d/e/f"));
+    TF_AXIOM(!notice.AffectsPrefix("/z"));
+
+    // Merged notices affect everything either notice affects.
+    ArNotice::ResolverChanged merged(IntContext(0));
+    merged.AddChangedAssetPath("/z/1.usd");
+    merged.Merge(notice);
+    TF_AXIOM(merged.AffectsContext(ArResolverContext()));
+    TF_AXIOM(merged.AffectsAssetPath("/z/1.usd"));
+    TF_AXIOM(merged.AffectsAssetPath("/a/b/c.usd"));
+    TF_AXIOM(merged.AffectsAssetPath("/d/e/f.usd"));
+    TF_AXIOM(!merged.AffectsAssetPath("/z/2.usd"));
+
+    merged.Merge(affectsAllNotice);
+    TF_AXIOM(merged.AffectsAllAssetPaths());
+    TF_AXIOM(merged.GetChangedAssetPaths().empty());
+    TF_AXIOM(merged.AffectsAssetPath("/z/2.usd"));
+
+    ArNotice::ResolverChanged mergedContexts(IntContext(0));
+    mergedContexts.AddChangedPrefix("/a");
+    ArNotice::ResolverChanged otherContext(IntContext(1));
+    otherContext.AddChangedPrefix("/b");
+    mergedContexts.Merge(otherContext);
+    TF_AXIOM(!mergedContexts.AffectsAllAssetPaths());
+    TF_AXIOM(mergedContexts.AffectsPrefix("/b"));
+    TF_AXIOM(!mergedContexts.AffectsPrefix("/c"));
+    TF_AXIOM(mergedContexts.AffectsContext(ArResolverContext(IntContext(0))));
+    TF_AXIOM(mergedContexts.AffectsContext(ArResolverContext(IntContext(1))));
+    TF_AXIOM(!mergedContexts.AffectsContext(ArResolverContext(IntContext(2))));
+
+    // Merging many notices checks each notice's contexts without nesting
+    // calls for every merge.
+    ArNotice::ResolverChanged manyMerged(IntContext(0));
+    for (int i = 1; i < 100000; ++i) {
+        manyMerged.Merge(ArNotice::ResolverChanged(IntContext(i)));
+    }
+    TF_AXIOM(manyMerged.AffectsContext(ArResolverContext(IntContext(0))));
+    TF_AXIOM(manyMerged.AffectsContext(ArResolverContext(IntContext(99999))));
+    TF_AXIOM(!manyMerged.AffectsContext(ArResolverContext(IntContext(-1))));
+}
+
 int main(int argc, char** argv)
 {
     TestResolverChangedNotice();
+    TestResolverChangedNoticePaths();
     printf("PASSED!\n");
     return 0;
 }
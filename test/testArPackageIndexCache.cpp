@@ -0,0 +1,282 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include <pxr/ar/inMemoryAsset.h>
+#include <pxr/ar/notice.h>
+#include <pxr/ar/packageIndexCache.h>
+#include <pxr/tf/diagnostic.h>
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace pxr;
+
+static ArPackageIndexCache::IndexConstPtr
+_MakeIndex(size_t numMembers)
+{
+    std::shared_ptr<ArPackageIndexCache::Index> index =
+        std::make_shared<ArPackageIndexCache::Index>();
+    for (size_t i = 0; i < numMembers; ++i) {
+        ArPackageIndexCache::Member member;
+        member.offset = i * 100;
+        member.size = i;
+        member.compressedSize = i;
+        index->AddMember("file_" + std::to_string(i), member);
+    }
+    return index;
+}
+
+static void
+TestIndex()
+{
+    std::shared_ptr<ArPackageIndexCache::Index> index =
+        std::make_shared<ArPackageIndexCache::Index>();
+    const size_t emptySize = index->GetMemoryUsage();
+    TF_AXIOM(index->GetNumMembers() == 0);
+    TF_AXIOM(!index->FindMember("a.file"));
+
+    ArPackageIndexCache::Member member;
+    member.offset = 10;
+    member.size = 20;
+    member.compressedSize = 5;
+    member.checksum = 1234;
+    member.compression = 8;
+    index->AddMember("a.file", member);
+
+    // Adding a record for an existing path does not change it.
+    member.offset = 99;
+    index->AddMember("a.file", member);
+
+    TF_AXIOM(index->GetNumMembers() == 1);
+    TF_AXIOM(index->GetMemoryUsage() > emptySize);
+
+    const ArPackageIndexCache::Member* found = index->FindMember("a.file");
+    TF_AXIOM(found);
+    TF_AXIOM(found->offset == 10);
+    TF_AXIOM(found->size == 20);
+    TF_AXIOM(found->compressedSize == 5);
+    TF_AXIOM(found->checksum == 1234);
+    TF_AXIOM(found->compression == 8);
+    TF_AXIOM(found->flags == 0);
+
+    // Packages read into memory count towards the index's memory usage.
+    TF_AXIOM(!index->GetPackageAsset());
+    TF_AXIOM(!index->GetPackageBuffer());
+
+    const size_t packageSize = 1024;
+    std::shared_ptr<const char> buffer(
+        new char[packageSize](), std::default_delete<const char[]>());
+    const std::shared_ptr<ArAsset> asset =
+        ArInMemoryAsset::FromBuffer(buffer, packageSize);
+
+    const size_t sizeWithoutPackage = index->GetMemoryUsage();
+    index->SetPackage(asset, buffer);
+    TF_AXIOM(index->GetPackageAsset() == asset);
+    TF_AXIOM(index->GetPackageBuffer() == buffer);
+    TF_AXIOM(index->GetMemoryUsage() == sizeWithoutPackage + packageSize);
+
+    index->SetPackage(nullptr, nullptr);
+    TF_AXIOM(!index->GetPackageAsset());
+    TF_AXIOM(index->GetMemoryUsage() == sizeWithoutPackage);
+}
+
+static void
+TestFindAndInsert()
+{
+    ArPackageIndexCache& cache = ArPackageIndexCache::GetInstance();
+    cache.Clear();
+    TF_AXIOM(cache.GetMemoryUsage() == 0);
+
+    const ArPackageIndexCache::IndexConstPtr index = _MakeIndex(10);
+    cache.Insert("/a.package", ArTimestamp(1.0), index);
+    TF_AXIOM(cache.Find("/a.package", ArTimestamp(1.0)) == index);
+    TF_AXIOM(cache.GetMemoryUsage() == index->GetMemoryUsage());
+    TF_AXIOM(!cache.Find("/b.package", ArTimestamp(1.0)));
+
+    // Looking up an index for a different timestamp discards the cached
+    // index, since the package has changed.
+    TF_AXIOM(!cache.Find("/a.package", ArTimestamp(2.0)));
+    TF_AXIOM(!cache.Find("/a.package", ArTimestamp(1.0)));
+    TF_AXIOM(cache.GetMemoryUsage() == 0);
+
+    // Indexes without a valid timestamp are never cached.
+    cache.Insert("/a.package", ArTimestamp(), index);
+    TF_AXIOM(!cache.Find("/a.package", ArTimestamp()));
+
+    // Inserting an index for a package replaces the existing index.
+    const ArPackageIndexCache::IndexConstPtr newIndex = _MakeIndex(5);
+    cache.Insert("/a.package", ArTimestamp(1.0), index);
+    cache.Insert("/a.package", ArTimestamp(2.0), newIndex);
+    TF_AXIOM(cache.Find("/a.package", ArTimestamp(2.0)) == newIndex);
+    TF_AXIOM(cache.GetMemoryUsage() == newIndex->GetMemoryUsage());
+
+    cache.Remove("/a.package");
+    TF_AXIOM(!cache.Find("/a.package", ArTimestamp(2.0)));
+    TF_AXIOM(cache.GetMemoryUsage() == 0);
+}
+
+static void
+TestMemoryBudget()
+{
+    ArPackageIndexCache& cache = ArPackageIndexCache::GetInstance();
+    cache.Clear();
+
+    const size_t originalBudget = cache.GetMemoryBudget();
+
+    const ArPackageIndexCache::IndexConstPtr a = _MakeIndex(10);
+    const ArPackageIndexCache::IndexConstPtr b = _MakeIndex(10);
+    const ArPackageIndexCache::IndexConstPtr c = _MakeIndex(10);
+    TF_AXIOM(a->GetMemoryUsage() == b->GetMemoryUsage());
+    TF_AXIOM(a->GetMemoryUsage() == c->GetMemoryUsage());
+
+    // Allow room for two indexes.
+    cache.SetMemoryBudget(a->GetMemoryUsage() * 2);
+    cache.Insert("/a.package", ArTimestamp(1.0), a);
+    cache.Insert("/b.package", ArTimestamp(1.0), b);
+
+    // Looking up a makes b the least recently used index, so it's the one
+    // evicted when c is added.
+    TF_AXIOM(cache.Find("/a.package", ArTimestamp(1.0)) == a);
+    cache.Insert("/c.package", ArTimestamp(1.0), c);
+    TF_AXIOM(cache.GetMemoryUsage() <= cache.GetMemoryBudget());
+    TF_AXIOM(cache.Find("/a.package", ArTimestamp(1.0)) == a);
+    TF_AXIOM(!cache.Find("/b.package", ArTimestamp(1.0)));
+    TF_AXIOM(cache.Find("/c.package", ArTimestamp(1.0)) == c);
+
+    // Shrinking the budget evicts indexes immediately.
+    cache.SetMemoryBudget(a->GetMemoryUsage());
+    TF_AXIOM(!cache.Find("/a.package", ArTimestamp(1.0)));
+    TF_AXIOM(cache.Find("/c.package", ArTimestamp(1.0)) == c);
+
+    // An index larger than the entire budget is not kept.
+    cache.SetMemoryBudget(0);
+    TF_AXIOM(cache.GetMemoryUsage() == 0);
+    cache.Insert("/a.package", ArTimestamp(1.0), a);
+    TF_AXIOM(!cache.Find("/a.package", ArTimestamp(1.0)));
+
+    cache.SetMemoryBudget(originalBudget);
+}
+
+static ArPackageIndexCache::IndexConstPtr
+_MakeIndexWithPackage(size_t numMembers)
+{
+    std::shared_ptr<ArPackageIndexCache::Index> index =
+        std::const_pointer_cast<ArPackageIndexCache::Index>(
+            _MakeIndex(numMembers));
+
+    const size_t packageSize = 16;
+    std::shared_ptr<const char> buffer(
+        new char[packageSize](), std::default_delete<const char[]>());
+    index->SetPackage(
+        ArInMemoryAsset::FromBuffer(buffer, packageSize), buffer);
+    return index;
+}
+
+static void
+TestOpenPackageLimit()
+{
+    ArPackageIndexCache& cache = ArPackageIndexCache::GetInstance();
+    cache.Clear();
+    TF_AXIOM(cache.GetNumOpenPackages() == 0);
+
+    const size_t originalLimit = cache.GetOpenPackageLimit();
+    cache.SetOpenPackageLimit(2);
+
+    const ArPackageIndexCache::IndexConstPtr a = _MakeIndexWithPackage(10);
+    const ArPackageIndexCache::IndexConstPtr b = _MakeIndex(10);
+    const ArPackageIndexCache::IndexConstPtr c = _MakeIndexWithPackage(10);
+    const ArPackageIndexCache::IndexConstPtr d = _MakeIndexWithPackage(10);
+
+    cache.Insert("/a.package", ArTimestamp(1.0), a);
+    cache.Insert("/b.package", ArTimestamp(1.0), b);
+    cache.Insert("/c.package", ArTimestamp(1.0), c);
+    TF_AXIOM(cache.GetNumOpenPackages() == 2);
+
+    // Adding a third index holding a package evicts the least recently
+    // used index holding a package, but not indexes without one.
+    cache.Insert("/d.package", ArTimestamp(1.0), d);
+    TF_AXIOM(cache.GetNumOpenPackages() == 2);
+    TF_AXIOM(!cache.Find("/a.package", ArTimestamp(1.0)));
+    TF_AXIOM(cache.Find("/b.package", ArTimestamp(1.0)) == b);
+    TF_AXIOM(cache.Find("/c.package", ArTimestamp(1.0)) == c);
+    TF_AXIOM(cache.Find("/d.package", ArTimestamp(1.0)) == d);
+
+    // Lowering the limit evicts indexes immediately.
+    cache.SetOpenPackageLimit(1);
+    TF_AXIOM(cache.GetNumOpenPackages() == 1);
+    TF_AXIOM(!cache.Find("/c.package", ArTimestamp(1.0)));
+    TF_AXIOM(cache.Find("/d.package", ArTimestamp(1.0)) == d);
+
+    cache.Remove("/d.package");
+    TF_AXIOM(cache.GetNumOpenPackages() == 0);
+
+    cache.SetOpenPackageLimit(originalLimit);
+    cache.Clear();
+}
+
+static void
+TestResolverChangedNotice()
+{
+    ArPackageIndexCache& cache = ArPackageIndexCache::GetInstance();
+    cache.Clear();
+
+    const ArPackageIndexCache::IndexConstPtr index = _MakeIndex(10);
+    cache.Insert("/a.package", ArTimestamp(1.0), index);
+    TF_AXIOM(cache.Find("/a.package", ArTimestamp(1.0)) == index);
+
+    // Notices that aren't restricted to specific paths don't affect the
+    // cache, since indexes are validated by their package's timestamp.
+    ArNotice::ResolverChanged().Send();
+    TF_AXIOM(cache.Find("/a.package", ArTimestamp(1.0)) == index);
+    TF_AXIOM(cache.GetMemoryUsage() == index->GetMemoryUsage());
+
+    // A notice restricted to specific paths only drops the indexes for
+    // the named packages.
+    const ArPackageIndexCache::IndexConstPtr b = _MakeIndex(10);
+    const ArPackageIndexCache::IndexConstPtr c = _MakeIndex(10);
+    cache.Insert("/b.package", ArTimestamp(1.0), b);
+    cache.Insert("/dir/c.package", ArTimestamp(1.0), c);
+
+    ArNotice::ResolverChanged pathNotice;
+    pathNotice.AddChangedAssetPath("/a.package");
+    pathNotice.Send();
+    TF_AXIOM(!cache.Find("/a.package", ArTimestamp(1.0)));
+    TF_AXIOM(cache.Find("/b.package", ArTimestamp(1.0)) == b);
+    TF_AXIOM(cache.Find("/dir/c.package", ArTimestamp(1.0)) == c);
+    TF_AXIOM(cache.GetMemoryUsage() ==
+        b->GetMemoryUsage() + c->GetMemoryUsage());
+
+    ArNotice::ResolverChanged prefixNotice;
+    prefixNotice.AddChangedPrefix("/dir");
+    prefixNotice.Send();
+    TF_AXIOM(cache.Find("/b.package", ArTimestamp(1.0)) == b);
+    TF_AXIOM(!cache.Find("/dir/c.package", ArTimestamp(1.0)));
+    TF_AXIOM(cache.GetMemoryUsage() == b->GetMemoryUsage());
+
+    cache.Clear();
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "TestIndex..." << std::endl;
+    TestIndex();
+
+    std::cout << "TestFindAndInsert..." << std::endl;
+    TestFindAndInsert();
+
+    std::cout << "TestMemoryBudget..." << std::endl;
+    TestMemoryBudget();
+
+    std::cout << "TestOpenPackageLimit..." << std::endl;
+    TestOpenPackageLimit();
+
+    std::cout << "TestResolverChangedNotice..." << std::endl;
+    TestResolverChangedNotice();
+
+    std::cout << "Passed!" << std::endl;
+
+    return EXIT_SUCCESS;
+}
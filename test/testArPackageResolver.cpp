@@ -0,0 +1,437 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include "plugin.h"
+
+#include <pxr/ar/asset.h>
+#include <pxr/ar/packageUtils.h>
+#include <pxr/ar/resolvedPath.h>
+#include <pxr/ar/resolver.h>
+#include <pxr/ar/resolverScopedCache.h>
+#include <pxr/ar/writableAsset.h>
+#include <pxr/plug/plugin.h>
+#include <pxr/plug/registry.h>
+#include <pxr/tf/diagnostic.h>
+#include <pxr/tf/errorMark.h>
+#include <pxr/tf/fileUtils.h>
+#include <pxr/tf/getenv.h>
+#include <pxr/tf/stringUtils.h>
+#include <pxr/arch/fileSystem.h>
+#include <pxr/arch/systemInfo.h>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace pxr;
+
+static void
+SetupPlugins()
+{
+    // Set the preferred resolver to ArDefaultResolver before
+    // running any test cases.
+    ArSetPreferredResolver("ArDefaultResolver");
+
+    // Register TestArPackageResolver plugin, which handles packages with
+    // the "package" extension.
+    const std::string packageResolverPluginPath = TfGetenv("PLUGIN_PATH");
+
+    PlugPluginPtrVector plugins =
+        PlugRegistry::GetInstance().RegisterPlugins(packageResolverPluginPath);
+
+    TF_AXIOM(plugins.size() == 1);
+    TF_AXIOM(plugins[0]->GetName() == "TestArPackageResolver");
+}
+
+static void
+_WriteAsset(const std::string& path, const std::string& contents)
+{
+    std::shared_ptr<ArWritableAsset> asset =
+        ArGetResolver().OpenAssetForWrite(
+            ArResolvedPath(path), ArResolver::WriteMode::Replace);
+    TF_AXIOM(asset);
+    TF_AXIOM(asset->Write(contents.c_str(), contents.size(), 0) ==
+        contents.size());
+    TF_AXIOM(asset->Close());
+}
+
+static std::string
+_ReadAsset(const std::string& path)
+{
+    std::shared_ptr<ArAsset> asset =
+        ArGetResolver().OpenAsset(ArResolvedPath(path));
+    TF_AXIOM(asset);
+
+    std::shared_ptr<const char> buffer = asset->GetBuffer();
+    TF_AXIOM(buffer);
+    return std::string(buffer.get(), asset->GetSize());
+}
+
+static uint32_t
+_ComputeCrc32(const std::string& data)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (const unsigned char c : data) {
+        crc ^= c;
+        for (int i = 0; i < 8; ++i) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+static void
+_AppendU16(std::string* s, uint16_t value)
+{
+    s->push_back(static_cast<char>(value & 0xFF));
+    s->push_back(static_cast<char>(value >> 8));
+}
+
+static void
+_AppendU32(std::string* s, uint32_t value)
+{
+    _AppendU16(s, static_cast<uint16_t>(value & 0xFFFF));
+    _AppendU16(s, static_cast<uint16_t>(value >> 16));
+}
+
+// Writes a zip archive to \p path containing the given (name, contents)
+// pairs, stored without compression.
+static void
+_WriteZipArchive(
+    const std::string& path,
+    const std::vector<std::pair<std::string, std::string>>& files)
+{
+    std::string archive, centralDir;
+    for (const auto& file : files) {
+        const std::string& name = file.first;
+        const std::string& contents = file.second;
+        const uint32_t crc = _ComputeCrc32(contents);
+        const uint32_t offset = static_cast<uint32_t>(archive.size());
+
+        _AppendU32(&archive, 0x04034b50); // Local file header signature
+        _AppendU16(&archive, 10);         // Version needed to extract
+        _AppendU16(&archive, 0);          // Flags
+        _AppendU16(&archive, 0);          // Compression method (stored)
+        _AppendU32(&archive, 0);          // Modification time and date
+        _AppendU32(&archive, crc);
+        _AppendU32(&archive, static_cast<uint32_t>(contents.size()));
+        _AppendU32(&archive, static_cast<uint32_t>(contents.size()));
+        _AppendU16(&archive, static_cast<uint16_t>(name.size()));
+        _AppendU16(&archive, 0);          // Extra field length
+        archive += name;
+        archive += contents;
+
+        _AppendU32(&centralDir, 0x02014b50); // Central directory signature
+        _AppendU16(&centralDir, 20);         // Version made by
+        _AppendU16(&centralDir, 10);         // Version needed to extract
+        _AppendU16(&centralDir, 0);          // Flags
+        _AppendU16(&centralDir, 0);          // Compression method (stored)
+        _AppendU32(&centralDir, 0);          // Modification time and date
+        _AppendU32(&centralDir, crc);
+        _AppendU32(&centralDir, static_cast<uint32_t>(contents.size()));
+        _AppendU32(&centralDir, static_cast<uint32_t>(contents.size()));
+        _AppendU16(&centralDir, static_cast<uint16_t>(name.size()));
+        _AppendU16(&centralDir, 0);          // Extra field length
+        _AppendU16(&centralDir, 0);          // Comment length
+        _AppendU16(&centralDir, 0);          // Disk number
+        _AppendU16(&centralDir, 0);          // Internal attributes
+        _AppendU32(&centralDir, 0);          // External attributes
+        _AppendU32(&centralDir, offset);
+        centralDir += name;
+    }
+
+    const uint32_t centralDirOffset = static_cast<uint32_t>(archive.size());
+    archive += centralDir;
+
+    _AppendU32(&archive, 0x06054b50); // End of central directory signature
+    _AppendU16(&archive, 0);          // Disk number
+    _AppendU16(&archive, 0);          // Disk with central directory
+    _AppendU16(&archive, static_cast<uint16_t>(files.size()));
+    _AppendU16(&archive, static_cast<uint16_t>(files.size()));
+    _AppendU32(&archive, static_cast<uint32_t>(centralDir.size()));
+    _AppendU32(&archive, centralDirOffset);
+    _AppendU16(&archive, 0);          // Comment length
+
+    _WriteAsset(path, archive);
+}
+
+static void
+TestCopyAssetFromPackage()
+{
+    const std::string tmpDir =
+        ArchMakeTmpSubdir(ArchGetCwd(), "testArPackageResolver_CPP_Copy");
+    TF_AXIOM(!tmpDir.empty());
+
+    // Use contents larger than the 8 MiB buffer ArResolver uses when
+    // streaming a copy so the copy takes multiple iterations.
+    std::string contents;
+    for (size_t i = 0; contents.size() < 9 * 1024 * 1024; ++i) {
+        contents += TfStringPrintf("line %zu\n", i);
+    }
+
+    const std::string archivePath = tmpDir + "/archive.zip";
+    _WriteZipArchive(archivePath, { { "dir/file.txt", contents } });
+
+    // Files in a package are opened through the package resolver and
+    // streamed into the destination.
+    const std::string srcPath =
+        ArJoinPackageRelativePath(archivePath, "dir/file.txt");
+    const std::string dstPath = tmpDir + "/dst.txt";
+    TF_AXIOM(ArGetResolver().CopyAsset(
+        ArResolvedPath(srcPath), ArResolvedPath(dstPath),
+        ArResolver::WriteMode::Replace));
+    TF_AXIOM(_ReadAsset(dstPath) == contents);
+
+    // Copying a file that doesn't exist in the package fails without
+    // touching the destination.
+    {
+        TfErrorMark m;
+        TF_AXIOM(!ArGetResolver().CopyAsset(
+            ArResolvedPath(
+                ArJoinPackageRelativePath(archivePath, "bogus.txt")),
+            ArResolvedPath(dstPath),
+            ArResolver::WriteMode::Replace));
+        TF_AXIOM(!m.IsClean());
+        m.Clear();
+    }
+    TF_AXIOM(_ReadAsset(dstPath) == contents);
+
+    // Files in packages cannot be written to.
+    {
+        TfErrorMark m;
+        TF_AXIOM(!ArGetResolver().CopyAsset(
+            ArResolvedPath(dstPath),
+            ArResolvedPath(
+                ArJoinPackageRelativePath(archivePath, "new.txt")),
+            ArResolver::WriteMode::Replace));
+        TF_AXIOM(!m.IsClean());
+        m.Clear();
+    }
+
+    TfRmTree(tmpDir);
+}
+
+static void
+TestResolveNestedPackages()
+{
+    const std::string tmpDir =
+        ArchMakeTmpSubdir(ArchGetCwd(), "testArPackageResolver_CPP_Nested");
+    TF_AXIOM(!tmpDir.empty());
+
+    const std::string archivePath = tmpDir + "/outer.zip";
+    _WriteZipArchive(archivePath, {
+        { "inner.package", "" },
+        { "dir/file.txt", "contents" } });
+
+    ArResolver& resolver = ArGetResolver();
+    const std::string innerPackagePath =
+        ArJoinPackageRelativePath(archivePath, "inner.package");
+
+    // ArZipPackageResolver resolves "inner.package" in the archive, then
+    // _TestPackageResolver resolves "file.txt" in the inner package, which
+    // it is given as a package-relative path.
+    _TestPackageResolverClearCalls();
+    const std::string path = ArJoinPackageRelativePath(
+        { archivePath, "inner.package", "file.txt" });
+    TF_AXIOM(resolver.Resolve(path) == path);
+    TF_AXIOM(_TestPackageResolverGetResolveCalls() ==
+        std::vector<_TestPackageResolverCall>({
+            { innerPackagePath, "file.txt" } }));
+
+    // Opening the asset goes straight to the resolver for the innermost
+    // package.
+    _TestPackageResolverClearCalls();
+    TF_AXIOM(!resolver.OpenAsset(ArResolvedPath(path)));
+    TF_AXIOM(_TestPackageResolverGetResolveCalls().empty());
+    TF_AXIOM(_TestPackageResolverGetOpenAssetCalls() ==
+        std::vector<_TestPackageResolverCall>({
+            { innerPackagePath, "file.txt" } }));
+
+    // If the archive doesn't contain the inner package, resolution stops
+    // at the archive and _TestPackageResolver is never consulted.
+    _TestPackageResolverClearCalls();
+    TF_AXIOM(resolver.Resolve(ArJoinPackageRelativePath(
+        { archivePath, "missing.package", "file.txt" })).empty());
+    TF_AXIOM(_TestPackageResolverGetResolveCalls().empty());
+
+    // Files stored directly in the archive are handled by
+    // ArZipPackageResolver alone.
+    _TestPackageResolverClearCalls();
+    const std::string filePath =
+        ArJoinPackageRelativePath(archivePath, "dir/file.txt");
+    TF_AXIOM(resolver.Resolve(filePath) == filePath);
+    TF_AXIOM(_ReadAsset(filePath) == "contents");
+    TF_AXIOM(_TestPackageResolverGetResolveCalls().empty());
+    TF_AXIOM(_TestPackageResolverGetOpenAssetCalls().empty());
+
+    // With the nesting reversed, _TestPackageResolver resolves "inner.zip"
+    // in the outer package and ArZipPackageResolver opens the archive
+    // through it to look for "file.txt". _TestPackageResolver doesn't
+    // provide any contents, so the path doesn't resolve.
+    const std::string packagePath = tmpDir + "/outer.package";
+    _WriteAsset(packagePath, "");
+
+    _TestPackageResolverClearCalls();
+    TF_AXIOM(resolver.Resolve(ArJoinPackageRelativePath(
+        { packagePath, "inner.zip", "file.txt" })).empty());
+    TF_AXIOM(_TestPackageResolverGetResolveCalls() ==
+        std::vector<_TestPackageResolverCall>({
+            { packagePath, "inner.zip" } }));
+    TF_AXIOM(_TestPackageResolverGetOpenAssetCalls() ==
+        std::vector<_TestPackageResolverCall>({
+            { packagePath, "inner.zip" } }));
+
+    TfRmTree(tmpDir);
+}
+
+static void
+TestPackageExtensions()
+{
+    const std::string tmpDir =
+        ArchMakeTmpSubdir(ArchGetCwd(), "testArPackageResolver_CPP_Ext");
+    TF_AXIOM(!tmpDir.empty());
+
+    const std::string archivePath = tmpDir + "/Archive.ZIP";
+    _WriteZipArchive(archivePath, {
+        { "inner.PACKAGE", "" },
+        { ".package", "" },
+        { "dir/file.txt", "contents" } });
+
+    ArResolver& resolver = ArGetResolver();
+
+    // Package resolvers are selected without regard to the case of the
+    // package's extension, for both the outer package and packaged paths.
+    const std::string filePath =
+        ArJoinPackageRelativePath(archivePath, "dir/file.txt");
+    TF_AXIOM(resolver.Resolve(filePath) == filePath);
+
+    const std::string innerPackagePath =
+        ArJoinPackageRelativePath(archivePath, "inner.PACKAGE");
+    TF_AXIOM(resolver.GetExtension(innerPackagePath) == "PACKAGE");
+
+    _TestPackageResolverClearCalls();
+    const std::string path = ArJoinPackageRelativePath(
+        { archivePath, "inner.PACKAGE", "file.txt" });
+    TF_AXIOM(resolver.Resolve(path) == path);
+    TF_AXIOM(_TestPackageResolverGetResolveCalls() ==
+        std::vector<_TestPackageResolverCall>({
+            { innerPackagePath, "file.txt" } }));
+
+    // A packaged path whose name begins with "." is a dot file without an
+    // extension, so it isn't treated as a package.
+    TF_AXIOM(resolver.GetExtension(
+        ArJoinPackageRelativePath(archivePath, ".package")).empty());
+
+    _TestPackageResolverClearCalls();
+    TF_AXIOM(resolver.Resolve(ArJoinPackageRelativePath(
+        { archivePath, ".package", "file.txt" })).empty());
+    TF_AXIOM(_TestPackageResolverGetResolveCalls().empty());
+
+    // Trailing separators are ignored when computing the extension of a
+    // packaged path.
+    const std::string packagePath = tmpDir + "/outer.package";
+    _WriteAsset(packagePath, "");
+
+    const std::string trailingPackagePath =
+        ArJoinPackageRelativePath(packagePath, "inner.package/");
+    TF_AXIOM(resolver.GetExtension(trailingPackagePath) == "package");
+
+    _TestPackageResolverClearCalls();
+    const std::string trailingPath = ArJoinPackageRelativePath(
+        { packagePath, "inner.package/", "file.txt" });
+    TF_AXIOM(resolver.Resolve(trailingPath) == trailingPath);
+    TF_AXIOM(_TestPackageResolverGetResolveCalls() ==
+        std::vector<_TestPackageResolverCall>({
+            { packagePath, "inner.package/" },
+            { trailingPackagePath, "file.txt" } }));
+
+    TfRmTree(tmpDir);
+}
+
+static void
+TestResolveWithScopedCache()
+{
+    const std::string tmpDir =
+        ArchMakeTmpSubdir(ArchGetCwd(), "testArPackageResolver_CPP_Cache");
+    TF_AXIOM(!tmpDir.empty());
+
+    const std::string packagePath = tmpDir + "/outer.package";
+    _WriteAsset(packagePath, "");
+
+    ArResolver& resolver = ArGetResolver();
+    const std::string innerPackagePath =
+        ArJoinPackageRelativePath(packagePath, "inner.package");
+    const std::string path = ArJoinPackageRelativePath(
+        { packagePath, "inner.package", "a.file" });
+    const std::string otherPath = ArJoinPackageRelativePath(
+        { packagePath, "inner.package", "b.file" });
+
+    {
+        ArResolverScopedCache cache;
+        _TestPackageResolverClearCalls();
+
+        // Resolving the same package-relative path again within the scope
+        // doesn't consult the package resolver again.
+        TF_AXIOM(resolver.Resolve(path) == path);
+        TF_AXIOM(resolver.Resolve(path) == path);
+        TF_AXIOM(_TestPackageResolverGetResolveCalls() ==
+            std::vector<_TestPackageResolverCall>({
+                { packagePath, "inner.package" },
+                { innerPackagePath, "a.file" } }));
+
+        // Another path into the same package reuses the result of
+        // resolving "inner.package" in the outer package.
+        _TestPackageResolverClearCalls();
+        TF_AXIOM(resolver.Resolve(otherPath) == otherPath);
+        TF_AXIOM(_TestPackageResolverGetResolveCalls() ==
+            std::vector<_TestPackageResolverCall>({
+                { innerPackagePath, "b.file" } }));
+
+        // Results are kept for the rest of the scope even if the outer
+        // package is removed.
+        TF_AXIOM(ArchUnlinkFile(packagePath.c_str()) == 0);
+        _TestPackageResolverClearCalls();
+        TF_AXIOM(resolver.Resolve(path) == path);
+        TF_AXIOM(resolver.Resolve(otherPath) == otherPath);
+        TF_AXIOM(_TestPackageResolverGetResolveCalls().empty());
+    }
+
+    // Once the scope is closed, paths are resolved again and reflect the
+    // removal of the outer package.
+    _TestPackageResolverClearCalls();
+    TF_AXIOM(resolver.Resolve(path).empty());
+    TF_AXIOM(resolver.Resolve(otherPath).empty());
+    TF_AXIOM(_TestPackageResolverGetResolveCalls().empty());
+
+    // Without a scope, every request consults the package resolver.
+    _WriteAsset(packagePath, "");
+    _TestPackageResolverClearCalls();
+    TF_AXIOM(resolver.Resolve(path) == path);
+    TF_AXIOM(resolver.Resolve(path) == path);
+    TF_AXIOM(_TestPackageResolverGetResolveCalls().size() == 4);
+
+    TfRmTree(tmpDir);
+}
+
+int main(int argc, char** argv)
+{
+    SetupPlugins();
+
+    printf("TestCopyAssetFromPackage ...\n");
+    TestCopyAssetFromPackage();
+
+    printf("TestResolveNestedPackages ...\n");
+    TestResolveNestedPackages();
+
+    printf("TestPackageExtensions ...\n");
+    TestPackageExtensions();
+
+    printf("TestResolveWithScopedCache ...\n");
+    TestResolveWithScopedCache();
+
+    printf("Test PASSED\n");
+    return 0;
+}
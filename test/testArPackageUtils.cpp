@@ -0,0 +1,245 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include <pxr/ar/packageUtils.h>
+#include <pxr/tf/diagnostic.h>
+
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace pxr;
+
+static void
+TestSplitPackageRelativePathOuterView()
+{
+    {
+        const ArPackageRelativePathSplit split =
+            ArSplitPackageRelativePathOuterView("foo.file");
+        TF_AXIOM(split.packagePath == "foo.file");
+        TF_AXIOM(split.packagePathSuffix.empty());
+        TF_AXIOM(split.packagedPath.empty());
+        TF_AXIOM(!split.packagedPathIsEscaped);
+    }
+
+    {
+        const std::string path = "foo.pack[bar.pack[baz.file]]";
+        const ArPackageRelativePathSplit split =
+            ArSplitPackageRelativePathOuterView(path);
+        TF_AXIOM(split.packagePath == "foo.pack");
+        TF_AXIOM(split.packagePathSuffix.empty());
+        TF_AXIOM(split.packagedPath == "bar.pack[baz.file]");
+        TF_AXIOM(!split.packagedPathIsEscaped);
+
+        // The components must refer to the original path.
+        TF_AXIOM(split.packagePath.data() == path.data());
+        TF_AXIOM(split.packagedPath.data() == path.data() + 9);
+    }
+
+    {
+        // Only delimiters in the package portion of the packaged path
+        // are unescaped.
+        const ArPackageRelativePathSplit split =
+            ArSplitPackageRelativePathOuterView(
+                "foo]a.pack[bar\\[b.pack[baz\\]c.file]]");
+        TF_AXIOM(split.packagePath == "foo]a.pack");
+        TF_AXIOM(split.packagedPath == "bar\\[b.pack[baz\\]c.file]");
+        TF_AXIOM(split.packagedPathIsEscaped);
+        TF_AXIOM(split.GetPackagePath() == "foo]a.pack");
+        TF_AXIOM(split.GetPackagedPath() == "bar[b.pack[baz\\]c.file]");
+    }
+
+    {
+        // Escaped delimiters in nested packaged paths don't require
+        // unescaping at this level.
+        const ArPackageRelativePathSplit split =
+            ArSplitPackageRelativePathOuterView(
+                "foo.pack[bar.pack[baz\\]c.file]]");
+        TF_AXIOM(split.packagedPath == "bar.pack[baz\\]c.file]");
+        TF_AXIOM(!split.packagedPathIsEscaped);
+    }
+}
+
+static void
+TestSplitPackageRelativePathInnerView()
+{
+    {
+        const ArPackageRelativePathSplit split =
+            ArSplitPackageRelativePathInnerView("foo.file");
+        TF_AXIOM(split.packagePath == "foo.file");
+        TF_AXIOM(split.packagePathSuffix.empty());
+        TF_AXIOM(split.packagedPath.empty());
+    }
+
+    {
+        const ArPackageRelativePathSplit split =
+            ArSplitPackageRelativePathInnerView(
+                "foo.pack[bar.pack[baz.file]]");
+        TF_AXIOM(split.packagePath == "foo.pack[bar.pack");
+        TF_AXIOM(split.packagePathSuffix == "]");
+        TF_AXIOM(split.packagedPath == "baz.file");
+        TF_AXIOM(!split.packagedPathIsEscaped);
+        TF_AXIOM(split.GetPackagePath() == "foo.pack[bar.pack]");
+        TF_AXIOM(split.GetPackagedPath() == "baz.file");
+    }
+
+    {
+        const ArPackageRelativePathSplit split =
+            ArSplitPackageRelativePathInnerView(
+                "foo]a.pack[bar\\[b.pack[baz\\]c.file]]");
+        TF_AXIOM(split.packagedPath == "baz\\]c.file");
+        TF_AXIOM(split.packagedPathIsEscaped);
+        TF_AXIOM(split.GetPackagePath() == "foo]a.pack[bar\\[b.pack]");
+        TF_AXIOM(split.GetPackagedPath() == "baz]c.file");
+    }
+}
+
+static void
+TestStringWrappers()
+{
+    // The string-returning functions must agree with the views.
+    const char* paths[] = {
+        "", "foo.file", "foo[0].pack[bar.file]", "foo.pack[]",
+        "foo.pack[bar.pack[baz.file]]",
+        "foo]a.pack[bar\\[b.pack[baz\\]c.file]]",
+        "foo.pack[bar\\]]", "foo.pack\\]", "]]",
+    };
+
+    for (const char* path : paths) {
+        const ArPackageRelativePathSplit outer =
+            ArSplitPackageRelativePathOuterView(path);
+        TF_AXIOM(ArSplitPackageRelativePathOuter(path) == std::make_pair(
+            outer.GetPackagePath(), outer.GetPackagedPath()));
+
+        const ArPackageRelativePathSplit inner =
+            ArSplitPackageRelativePathInnerView(path);
+        TF_AXIOM(ArSplitPackageRelativePathInner(path) == std::make_pair(
+            inner.GetPackagePath(), inner.GetPackagedPath()));
+    }
+
+    TF_AXIOM(ArSplitPackageRelativePathOuter("foo.pack[bar\\]]") ==
+        std::make_pair(std::string("foo.pack"), std::string("bar]")));
+    TF_AXIOM(ArSplitPackageRelativePathInner("foo.pack[bar\\]]") ==
+        std::make_pair(std::string("foo.pack"), std::string("bar]")));
+}
+
+static void
+TestPackageRelativePath()
+{
+    using Segments = std::vector<std::string>;
+
+    {
+        const ArPackageRelativePath path("foo.file");
+        TF_AXIOM(!path.IsPackageRelativePath());
+        TF_AXIOM(path.GetSegments() == Segments({ "foo.file" }));
+        TF_AXIOM(path.GetOuterPackagePath() == "foo.file");
+        TF_AXIOM(path.GetInnermostPackagedPath() == "foo.file");
+    }
+
+    {
+        const ArPackageRelativePath path("");
+        TF_AXIOM(!path.IsPackageRelativePath());
+        TF_AXIOM(path.GetSegments() == Segments({ "" }));
+    }
+
+    {
+        const ArPackageRelativePath path("foo.pack[]");
+        TF_AXIOM(path.IsPackageRelativePath());
+        TF_AXIOM(path.GetSegments() == Segments({ "foo.pack" }));
+    }
+
+    {
+        const ArPackageRelativePath path(
+            "/dir/foo.pack[bar.pack[baz.pack[a/b/c.file]]]");
+        TF_AXIOM(path.IsPackageRelativePath());
+        TF_AXIOM(path.GetSegments() == Segments(
+            { "/dir/foo.pack", "bar.pack", "baz.pack", "a/b/c.file" }));
+        TF_AXIOM(path.GetOuterPackagePath() == "/dir/foo.pack");
+        TF_AXIOM(path.GetInnermostPackagedPath() == "a/b/c.file");
+    }
+
+    {
+        // Delimiters in each segment are unescaped, and joining the
+        // segments produces the original path.
+        const std::string pathStr = "foo]a.pack[bar\\[b.pack[baz\\]c.file]]";
+        const ArPackageRelativePath path(pathStr);
+        TF_AXIOM(path.GetSegments() == Segments(
+            { "foo]a.pack", "bar[b.pack", "baz]c.file" }));
+        TF_AXIOM(ArJoinPackageRelativePath(path.GetSegments()) == pathStr);
+    }
+
+    {
+        // Segments must match those found by repeatedly splitting off the
+        // outer package path.
+        const char* paths[] = {
+            "foo[0].pack[bar.file]", "foo.pack[bar\\]]",
+            "a.pack[b.pack[c.pack[d.pack[e.file]]]]",
+        };
+        for (const char* pathStr : paths) {
+            Segments expected;
+            std::string remaining = pathStr;
+            while (!remaining.empty()) {
+                const std::pair<std::string, std::string> split =
+                    ArSplitPackageRelativePathOuter(remaining);
+                expected.push_back(split.first);
+                remaining = split.second;
+            }
+            TF_AXIOM(ArPackageRelativePath(pathStr).GetSegments() == expected);
+        }
+    }
+}
+
+static void
+TestLongPaths()
+{
+    using Segments = std::vector<std::string>;
+
+    // Delimiters are scanned for in blocks of characters, so check paths
+    // with delimiters and escapes on either side of block boundaries.
+    for (size_t prefixLen = 0; prefixLen < 70; ++prefixLen) {
+        const std::string prefix(prefixLen, 'a');
+        const Segments segments = {
+            prefix + "]x.pack", "b" + prefix + "[y.pack", prefix + "c.file"
+        };
+
+        const std::string path = ArJoinPackageRelativePath(segments);
+        TF_AXIOM(path ==
+            prefix + "]x.pack[b" + prefix + "\\[y.pack[" + prefix + "c.file]]");
+        TF_AXIOM(ArIsPackageRelativePath(path));
+        TF_AXIOM(ArPackageRelativePath(path).GetSegments() == segments);
+
+        TF_AXIOM(ArSplitPackageRelativePathOuter(path) == std::make_pair(
+            segments[0], ArJoinPackageRelativePath(segments[1], segments[2])));
+
+        const std::pair<std::string, std::string> inner =
+            ArSplitPackageRelativePathInner(path);
+        TF_AXIOM(inner.first == ArJoinPackageRelativePath(
+            segments[0], segments[1]));
+        TF_AXIOM(inner.second == segments[2]);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    printf("TestSplitPackageRelativePathOuterView...\n");
+    TestSplitPackageRelativePathOuterView();
+
+    printf("TestSplitPackageRelativePathInnerView...\n");
+    TestSplitPackageRelativePathInnerView();
+
+    printf("TestStringWrappers...\n");
+    TestStringWrappers();
+
+    printf("TestPackageRelativePath...\n");
+    TestPackageRelativePath();
+
+    printf("TestLongPaths...\n");
+    TestLongPaths();
+
+    printf("Passed!\n");
+
+    return EXIT_SUCCESS;
+}
@@ -12,6 +12,7 @@
 #include <pxr/tf/hash.h>
 
 #include <string>
+#include <vector>
 
 using namespace pxr;
 
@@ -50,11 +51,13 @@ private:
 
 using TestStringContextObject = TestContextObject<std::string>;
 using TestIntContextObject = TestContextObject<int>;
+using TestDoubleContextObject = TestContextObject<double>;
 
 namespace pxr {
 
 AR_DECLARE_RESOLVER_CONTEXT(TestStringContextObject);
 AR_DECLARE_RESOLVER_CONTEXT(TestIntContextObject);
+AR_DECLARE_RESOLVER_CONTEXT(TestDoubleContextObject);
 
 }  // namespace pxr
 
@@ -201,6 +204,74 @@ TestMultipleContextObjects()
     }
 }
 
+static void
+TestInterning()
+{
+    const TestStringContextObject strObj("test string");
+    const TestIntContextObject intObj(42);
+
+    // Equal contexts share the same context objects, regardless of how
+    // they were constructed.
+    const ArResolverContext context(strObj, intObj);
+    const ArResolverContext testContext(std::vector<ArResolverContext>{
+        ArResolverContext(intObj), ArResolverContext(strObj)});
+    TF_AXIOM(context == testContext);
+    TF_AXIOM(context.Get<TestStringContextObject>() ==
+             testContext.Get<TestStringContextObject>());
+    TF_AXIOM(context.Get<TestIntContextObject>() ==
+             testContext.Get<TestIntContextObject>());
+
+    // Combining contexts shares their context objects instead of
+    // copying them.
+    const ArResolverContext strContext(TestStringContextObject("foo"));
+    const ArResolverContext combinedContext(
+        strContext, ArResolverContext(TestIntContextObject(7)));
+    TF_AXIOM(combinedContext.Get<TestStringContextObject>() ==
+             strContext.Get<TestStringContextObject>());
+
+    // Storage is released when the last context using it is destroyed,
+    // and later contexts with the same objects compare equal.
+    {
+        const ArResolverContext tmpContext(TestIntContextObject(1234));
+        TF_AXIOM(*tmpContext.Get<TestIntContextObject>() ==
+                 TestIntContextObject(1234));
+    }
+    const ArResolverContext ctx1(TestIntContextObject(1234));
+    const ArResolverContext ctx2(TestIntContextObject(1234));
+    TF_AXIOM(ctx1 == ctx2);
+    TF_AXIOM(hash_value(ctx1) == hash_value(ctx2));
+    TF_AXIOM(ctx1 != ArResolverContext(TestIntContextObject(4321)));
+}
+
+static void
+TestTypeIndex()
+{
+    // Each context object type is assigned a distinct, stable index.
+    const size_t strIndex =
+        Ar_GetContextObjectTypeIndex<TestStringContextObject>();
+    const size_t intIndex =
+        Ar_GetContextObjectTypeIndex<TestIntContextObject>();
+    TF_AXIOM(strIndex != intIndex);
+    TF_AXIOM(strIndex == Ar_GetContextObjectTypeIndex(
+        typeid(TestStringContextObject)));
+    TF_AXIOM(intIndex == Ar_GetContextObjectTypeIndex(
+        typeid(TestIntContextObject)));
+
+    // Looking up a type that no context holds, including one whose
+    // index is past the end of every context's lookup table.
+    const ArResolverContext context(TestIntContextObject(42));
+    TF_AXIOM(context.Get<TestDoubleContextObject>() == nullptr);
+    TF_AXIOM(context.Get<TestStringContextObject>() == nullptr);
+    TF_AXIOM(context.Get<TestIntContextObject>()->GetData() == 42);
+
+    const ArResolverContext doubleContext(
+        TestDoubleContextObject(1.5), context);
+    TF_AXIOM(doubleContext.Get<TestDoubleContextObject>()->GetData() == 1.5);
+    TF_AXIOM(doubleContext.Get<TestIntContextObject>() ==
+             context.Get<TestIntContextObject>());
+    TF_AXIOM(doubleContext.Get<TestStringContextObject>() == nullptr);
+}
+
 int main(int argc, char** argv)
 {
     printf("TestDefault ...\n");
@@ -212,6 +283,12 @@ int main(int argc, char** argv)
     printf("TestMultipleContextObjects ...\n");
     TestMultipleContextObjects();
 
+    printf("TestInterning ...\n");
+    TestInterning();
+
+    printf("TestTypeIndex ...\n");
+    TestTypeIndex();
+
     printf("All tests passed!\n");
     return 0;
 }
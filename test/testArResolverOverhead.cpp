@@ -0,0 +1,123 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include <pxr/ar/defaultResolverContext.h>
+#include <pxr/ar/resolvedPath.h>
+#include <pxr/ar/resolver.h>
+#include <pxr/ar/resolverContext.h>
+#include <pxr/ar/resolverContextBinder.h>
+#include <pxr/ar/resolverScopedCache.h>
+#include <pxr/tf/diagnostic.h>
+#include <pxr/tf/stopwatch.h>
+#include <pxr/arch/fileSystem.h>
+#include <pxr/arch/systemInfo.h>
+
+#include <cstdio>
+#include <string>
+
+using namespace pxr;
+
+// Measures the overhead of calling through ArGetResolver() rather than
+// calling the primary resolver directly. When no URI/IRI resolvers are
+// registered, ArGetResolver() dispatches straight to the primary resolver,
+// so this overhead should stay small.
+
+static const size_t _numIterations = 200000;
+
+template <class Fn>
+static double
+_TimePerCall(const Fn& fn)
+{
+    TfStopwatch watch;
+    watch.Start();
+    for (size_t i = 0; i < _numIterations; ++i) {
+        fn();
+    }
+    watch.Stop();
+    return watch.GetSeconds() * 1e9 / _numIterations;
+}
+
+template <class Fn>
+static void
+_Compare(const char* name, const Fn& fn)
+{
+    const double underlying = _TimePerCall(
+        [&fn]() { fn(ArGetUnderlyingResolver()); });
+    const double dispatched = _TimePerCall(
+        [&fn]() { fn(ArGetResolver()); });
+    printf("  %-24s %8.1f ns/call (primary resolver: %8.1f ns/call)\n",
+        name, dispatched, underlying);
+}
+
+int main(int argc, char** argv)
+{
+    ArSetPreferredResolver("ArDefaultResolver");
+
+    if (!ArGetRegisteredURISchemes().empty()) {
+        printf("URI/IRI resolvers are registered, timings include "
+            "dispatching by scheme.\n");
+    }
+
+    std::string tmpPath;
+    const int fd = ArchMakeTmpFile(
+        ArchGetCwd(), "testArResolverOverhead_CPP", &tmpPath);
+    TF_AXIOM(fd != -1);
+    FILE* tmpFile = ArchFdOpen(fd, "w");
+    TF_AXIOM(tmpFile);
+    fclose(tmpFile);
+
+    ArResolver& resolver = ArGetResolver();
+    ArResolver& underlyingResolver = ArGetUnderlyingResolver();
+
+    const ArResolvedPath resolvedPath = resolver.Resolve(tmpPath);
+    TF_AXIOM(resolvedPath);
+    TF_AXIOM(resolvedPath == underlyingResolver.Resolve(tmpPath));
+    TF_AXIOM(resolver.CreateIdentifier("sibling.txt", resolvedPath) ==
+        underlyingResolver.CreateIdentifier("sibling.txt", resolvedPath));
+
+    const ArResolverContext ctx(ArDefaultResolverContext({ArchGetCwd()}));
+
+    printf("Per-call overhead:\n");
+
+    _Compare("Resolve", [&tmpPath](ArResolver& r) {
+        r.Resolve(tmpPath);
+    });
+
+    _Compare("CreateIdentifier", [&resolvedPath](ArResolver& r) {
+        r.CreateIdentifier("sibling.txt", resolvedPath);
+    });
+
+    _Compare("GetExtension", [&tmpPath](ArResolver& r) {
+        r.GetExtension(tmpPath);
+    });
+
+    _Compare("BindContext", [&ctx](ArResolver& r) {
+        ArResolverContextBinder binder(&r, ctx);
+    });
+
+    {
+        ArResolverContextBinder binder(ctx);
+        TF_AXIOM(resolver.GetCurrentContext() == ctx);
+
+        _Compare("GetCurrentContext", [](ArResolver& r) {
+            r.GetCurrentContext();
+        });
+    }
+
+    {
+        ArResolverScopedCache cache;
+        TF_AXIOM(resolver.Resolve(tmpPath) == resolvedPath);
+
+        _Compare("Resolve (cache scope)", [&tmpPath](ArResolver& r) {
+            r.Resolve(tmpPath);
+        });
+    }
+
+    ArchUnlinkFile(tmpPath.c_str());
+
+    printf("Passed!\n");
+
+    return EXIT_SUCCESS;
+}
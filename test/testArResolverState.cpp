@@ -0,0 +1,161 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include <pxr/ar/defaultResolverContext.h>
+#include <pxr/ar/resolver.h>
+#include <pxr/ar/resolverContext.h>
+#include <pxr/ar/resolverContextBinder.h>
+#include <pxr/ar/resolverScopedCache.h>
+#include <pxr/ar/resolverState.h>
+#include <pxr/ar/writableAsset.h>
+#include <pxr/tf/diagnostic.h>
+#include <pxr/tf/fileUtils.h>
+#include <pxr/arch/fileSystem.h>
+#include <pxr/arch/systemInfo.h>
+
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace pxr;
+
+static void
+TestEmptyState()
+{
+    const ArResolverState state = ArCaptureResolverState();
+    TF_AXIOM(state.GetContext().IsEmpty());
+    TF_AXIOM(!state.HasCacheScope());
+
+    // Installing an empty state leaves the current thread untouched.
+    ArResolverStateScope scope(state);
+    TF_AXIOM(ArGetResolver().GetCurrentContext().IsEmpty());
+}
+
+static void
+TestCaptureState()
+{
+    const ArResolverContext context(
+        ArDefaultResolverContext({"/a", "/b"}));
+
+    ArResolverContextBinder binder(context);
+    ArResolverScopedCache cache;
+
+    const ArResolverState state = ArCaptureResolverState();
+    TF_AXIOM(state.GetContext() == context);
+    TF_AXIOM(state.HasCacheScope());
+
+    // Capturing the state must not affect the state of the current thread.
+    TF_AXIOM(ArGetResolver().GetCurrentContext() == context);
+}
+
+static void
+TestParallelForEach()
+{
+    const ArResolverContext context(
+        ArDefaultResolverContext({"/a", "/b"}));
+
+    std::vector<int> values(1000);
+    std::atomic<size_t> numMismatches(0);
+
+    // Without a bound context, workers see no context either.
+    ArParallelForEach(values, [&numMismatches](int) {
+        if (!ArGetResolver().GetCurrentContext().IsEmpty()) {
+            ++numMismatches;
+        }
+    });
+    TF_AXIOM(numMismatches == 0);
+
+    {
+        ArResolverContextBinder binder(context);
+        ArResolverScopedCache cache;
+
+        ArParallelForEach(
+            values.begin(), values.end(), [&context, &numMismatches](int) {
+                if (ArGetResolver().GetCurrentContext() != context) {
+                    ++numMismatches;
+                }
+            });
+        TF_AXIOM(numMismatches == 0);
+
+        // The calling thread participates in the work, so its state must
+        // be restored once the loop completes.
+        TF_AXIOM(ArGetResolver().GetCurrentContext() == context);
+    }
+
+    TF_AXIOM(ArGetResolver().GetCurrentContext().IsEmpty());
+}
+
+static void
+TestParallelForEachSharesCache()
+{
+    const std::string tmpDir =
+        ArchMakeTmpSubdir(ArchGetCwd(), "testArResolverState_CPP");
+    TF_AXIOM(!tmpDir.empty());
+
+    const std::string assetPath = tmpDir + "/asset.txt";
+    {
+        std::shared_ptr<ArWritableAsset> asset =
+            ArGetResolver().OpenAssetForWrite(
+                ArResolvedPath(assetPath), ArResolver::WriteMode::Replace);
+        TF_AXIOM(asset);
+        TF_AXIOM(asset->Close());
+    }
+
+    const ArResolverContext context(
+        ArDefaultResolverContext({ tmpDir }));
+
+    std::vector<int> values(1000);
+    std::atomic<size_t> numMismatches(0);
+
+    {
+        ArResolverContextBinder binder(context);
+        ArResolverScopedCache cache;
+
+        // Resolve the search path on this thread to populate the cache,
+        // then remove the asset it resolved to.
+        const ArResolvedPath resolvedPath =
+            ArGetResolver().Resolve("asset.txt");
+        TF_AXIOM(resolvedPath);
+        TF_AXIOM(ArchUnlinkFile(assetPath.c_str()) == 0);
+
+        // Workers must see the result cached above rather than searching
+        // for the asset again, which would now fail.
+        ArParallelForEach(
+            values, [&resolvedPath, &numMismatches](int) {
+                if (ArGetResolver().Resolve("asset.txt") != resolvedPath) {
+                    ++numMismatches;
+                }
+            });
+        TF_AXIOM(numMismatches == 0);
+    }
+
+    // Once the cache scope is closed, the asset is no longer found.
+    {
+        ArResolverContextBinder binder(context);
+        TF_AXIOM(!ArGetResolver().Resolve("asset.txt"));
+    }
+
+    TfRmTree(tmpDir);
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "TestEmptyState..." << std::endl;
+    TestEmptyState();
+
+    std::cout << "TestCaptureState..." << std::endl;
+    TestCaptureState();
+
+    std::cout << "TestParallelForEach..." << std::endl;
+    TestParallelForEach();
+
+    std::cout << "TestParallelForEachSharesCache..." << std::endl;
+    TestParallelForEachSharesCache();
+
+    std::cout << "Passed!" << std::endl;
+
+    return EXIT_SUCCESS;
+}
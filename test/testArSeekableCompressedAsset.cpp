@@ -0,0 +1,234 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include <pxr/ar/filesystemAsset.h>
+#include <pxr/ar/inMemoryAsset.h>
+#include <pxr/ar/resolvedPath.h>
+#include <pxr/ar/resolver.h>
+#include <pxr/ar/seekableCompressedAsset.h>
+#include <pxr/ar/writableAsset.h>
+#include <pxr/tf/diagnostic.h>
+#include <pxr/tf/errorMark.h>
+#include <pxr/tf/fileUtils.h>
+#include <pxr/tf/getenv.h>
+#include <pxr/arch/fileSystem.h>
+#include <pxr/arch/systemInfo.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace pxr;
+
+static const std::string _contents =
+    "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+static void
+_AppendU32(std::string* data, uint32_t value)
+{
+    for (size_t i = 0; i < 4; ++i) {
+        data->push_back(static_cast<char>((value >> (i * 8)) & 0xff));
+    }
+}
+
+// Returns \p contents in the zstd seekable format, split into frames of
+// \p frameSize bytes. Each frame stores its data in a single raw block so
+// that no compressor is needed to produce valid zstd data.
+static std::string
+_MakeSeekableData(const std::string& contents, size_t frameSize)
+{
+    std::string data, seekTable;
+    uint32_t numFrames = 0;
+    for (size_t offset = 0; offset < contents.size(); offset += frameSize) {
+        const size_t size = std::min(frameSize, contents.size() - offset);
+        const size_t frameStart = data.size();
+
+        // Frame header: single segment with a 1-byte content size.
+        _AppendU32(&data, 0xFD2FB528);
+        data.push_back(static_cast<char>(0x20));
+        data.push_back(static_cast<char>(size));
+
+        // Block header: last raw block of the given size.
+        const uint32_t blockHeader = 1 | static_cast<uint32_t>(size) << 3;
+        data.push_back(static_cast<char>(blockHeader & 0xff));
+        data.push_back(static_cast<char>((blockHeader >> 8) & 0xff));
+        data.push_back(static_cast<char>((blockHeader >> 16) & 0xff));
+        data.append(contents, offset, size);
+
+        _AppendU32(&seekTable, data.size() - frameStart);
+        _AppendU32(&seekTable, size);
+        ++numFrames;
+    }
+
+    _AppendU32(&data, 0x184D2A5E);
+    _AppendU32(&data, seekTable.size() + 9);
+    data += seekTable;
+    _AppendU32(&data, numFrames);
+    data.push_back('\0');
+    _AppendU32(&data, 0x8F92EAB1);
+    return data;
+}
+
+static std::shared_ptr<ArAsset>
+_MakeInMemoryAsset(const std::string& data)
+{
+    std::shared_ptr<char> buffer(
+        new char[data.size()], std::default_delete<char[]>());
+    memcpy(buffer.get(), data.data(), data.size());
+    return ArInMemoryAsset::FromBuffer(
+        std::shared_ptr<const char>(std::move(buffer)), data.size());
+}
+
+static void
+TestRead()
+{
+    const std::shared_ptr<ArSeekableCompressedAsset> asset =
+        ArSeekableCompressedAsset::Open(
+            _MakeInMemoryAsset(_MakeSeekableData(_contents, 10)),
+            /* maxCachedFrames = */ 2);
+    TF_AXIOM(asset);
+    TF_AXIOM(asset->GetSize() == _contents.size());
+    TF_AXIOM(asset->GetNumFrames() == 7);
+    TF_AXIOM(asset->GetFileUnsafe().first == nullptr);
+
+    // Reads within a frame, across frames and past the end of the asset.
+    char buffer[64];
+    TF_AXIOM(asset->Read(buffer, 4, 12) == 4);
+    TF_AXIOM(std::string(buffer, 4) == "cdef");
+    TF_AXIOM(asset->Read(buffer, 25, 5) == 25);
+    TF_AXIOM(std::string(buffer, 25) == _contents.substr(5, 25));
+    TF_AXIOM(asset->Read(buffer, sizeof(buffer), 58) == 4);
+    TF_AXIOM(std::string(buffer, 4) == "WXYZ");
+    TF_AXIOM(asset->Read(buffer, sizeof(buffer), _contents.size()) == 0);
+
+    // Reading the entire asset visits more frames than are cached.
+    TF_AXIOM(asset->Read(buffer, sizeof(buffer), 0) == _contents.size());
+    TF_AXIOM(std::string(buffer, _contents.size()) == _contents);
+
+    const std::shared_ptr<const char> contents = asset->GetBuffer();
+    TF_AXIOM(contents);
+    TF_AXIOM(std::string(contents.get(), _contents.size()) == _contents);
+    TF_AXIOM(asset->GetBuffer() == contents);
+}
+
+static void
+TestInvalidAsset()
+{
+    TfErrorMark mark;
+    TF_AXIOM(!ArSeekableCompressedAsset::Open(_MakeInMemoryAsset(_contents)));
+    TF_AXIOM(!mark.IsClean());
+    mark.Clear();
+
+    // A seek table referring to more data than the asset contains.
+    std::string data = _MakeSeekableData(_contents, 10);
+    data.erase(0, 20);
+    TF_AXIOM(!ArSeekableCompressedAsset::Open(_MakeInMemoryAsset(data)));
+    TF_AXIOM(!mark.IsClean());
+    mark.Clear();
+}
+
+static void
+TestUnsupported()
+{
+    TF_AXIOM(!ArSeekableCompressedAsset::IsEnabledForExtension("zst"));
+
+    TfErrorMark mark;
+    TF_AXIOM(!ArSeekableCompressedAsset::Open(
+        _MakeInMemoryAsset(_MakeSeekableData(_contents, 10))));
+    TF_AXIOM(!mark.IsClean());
+    mark.Clear();
+}
+
+static void
+_WriteAsset(const std::string& path, const std::string& contents)
+{
+    std::shared_ptr<ArWritableAsset> asset =
+        ArGetResolver().OpenAssetForWrite(
+            ArResolvedPath(path), ArResolver::WriteMode::Replace);
+    TF_AXIOM(asset);
+    TF_AXIOM(asset->Write(contents.c_str(), contents.size(), 0) ==
+        contents.size());
+    TF_AXIOM(asset->Close());
+}
+
+static void
+TestOpenWithDefaultResolver()
+{
+    const std::string tmpDir = ArchMakeTmpSubdir(
+        ArchGetCwd(), "testArSeekableCompressedAsset_CPP");
+    TF_AXIOM(!tmpDir.empty());
+
+    const std::string data = _MakeSeekableData(_contents, 10);
+    const std::string zstPath = tmpDir + "/asset.zst";
+    const std::string upperZstPath = tmpDir + "/upper.ZST";
+    const std::string otherPath = tmpDir + "/asset.other";
+    _WriteAsset(zstPath, data);
+    _WriteAsset(upperZstPath, data);
+    _WriteAsset(otherPath, data);
+
+    // The test is registered a second time with
+    // PXR_AR_SEEKABLE_COMPRESSED_EXTENSIONS set to "zst" when Ar is built
+    // with zstd support. In that case ArDefaultResolver decompresses
+    // assets with that extension, regardless of case.
+    const bool decompress = ArSeekableCompressedAsset::IsSupported() &&
+        TfGetenv("PXR_AR_SEEKABLE_COMPRESSED_EXTENSIONS") == "zst";
+    TF_AXIOM(ArSeekableCompressedAsset::IsEnabledForExtension("zst") ==
+        decompress);
+
+    for (const std::string& path : { zstPath, upperZstPath }) {
+        const std::shared_ptr<ArAsset> asset =
+            ArGetResolver().OpenAsset(ArResolvedPath(path));
+        TF_AXIOM(asset);
+
+        if (decompress) {
+            TF_AXIOM(dynamic_cast<ArSeekableCompressedAsset*>(asset.get()));
+            TF_AXIOM(asset->GetSize() == _contents.size());
+
+            const std::shared_ptr<const char> buffer = asset->GetBuffer();
+            TF_AXIOM(buffer);
+            TF_AXIOM(std::string(buffer.get(), asset->GetSize()) ==
+                _contents);
+        }
+        else {
+            TF_AXIOM(dynamic_cast<ArFilesystemAsset*>(asset.get()));
+            TF_AXIOM(asset->GetSize() == data.size());
+        }
+    }
+
+    // Assets with other extensions are always opened as they are.
+    const std::shared_ptr<ArAsset> asset =
+        ArGetResolver().OpenAsset(ArResolvedPath(otherPath));
+    TF_AXIOM(dynamic_cast<ArFilesystemAsset*>(asset.get()));
+    TF_AXIOM(asset->GetSize() == data.size());
+
+    TfRmTree(tmpDir);
+}
+
+int main(int argc, char** argv)
+{
+    ArSetPreferredResolver("ArDefaultResolver");
+
+    if (ArSeekableCompressedAsset::IsSupported()) {
+        std::cout << "TestRead..." << std::endl;
+        TestRead();
+
+        std::cout << "TestInvalidAsset..." << std::endl;
+        TestInvalidAsset();
+    }
+    else {
+        std::cout << "TestUnsupported..." << std::endl;
+        TestUnsupported();
+    }
+
+    std::cout << "TestOpenWithDefaultResolver..." << std::endl;
+    TestOpenWithDefaultResolver();
+
+    std::cout << "Passed!" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,232 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include <pxr/ar/filesystemAsset.h>
+#include <pxr/ar/inMemoryAsset.h>
+#include <pxr/ar/subrangeAsset.h>
+#include <pxr/tf/diagnostic.h>
+#include <pxr/tf/errorMark.h>
+#include <pxr/tf/fileUtils.h>
+#include <pxr/arch/fileSystem.h>
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace pxr;
+
+static const std::string _contents = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+static std::shared_ptr<ArAsset>
+_MakeInMemoryAsset()
+{
+    std::shared_ptr<char> buffer(
+        new char[_contents.size()], std::default_delete<char[]>());
+    memcpy(buffer.get(), _contents.data(), _contents.size());
+    return ArInMemoryAsset::FromBuffer(
+        std::shared_ptr<const char>(std::move(buffer)), _contents.size());
+}
+
+static std::string
+_ReadAll(const ArAsset& asset)
+{
+    std::string result(asset.GetSize(), '\0');
+    TF_AXIOM(asset.Read(&result[0], result.size(), 0) == result.size());
+    return result;
+}
+
+static void
+TestRead()
+{
+    const std::shared_ptr<ArAsset> parent = _MakeInMemoryAsset();
+    const ArSubrangeAsset asset(parent, 10, 6);
+
+    TF_AXIOM(asset.GetParent() == parent);
+    TF_AXIOM(asset.GetOffset() == 10);
+    TF_AXIOM(asset.GetSize() == 6);
+    TF_AXIOM(_ReadAll(asset) == "abcdef");
+
+    // Reads are clamped to the end of the range rather than the end of
+    // the parent asset.
+    char buffer[16] = { 0 };
+    TF_AXIOM(asset.Read(buffer, sizeof(buffer), 2) == 4);
+    TF_AXIOM(std::string(buffer, 4) == "cdef");
+    TF_AXIOM(asset.Read(buffer, sizeof(buffer), 6) == 0);
+    TF_AXIOM(asset.Read(buffer, sizeof(buffer), 100) == 0);
+
+    // An empty range is valid.
+    const ArSubrangeAsset emptyAsset(parent, _contents.size(), 0);
+    TF_AXIOM(emptyAsset.GetSize() == 0);
+    TF_AXIOM(emptyAsset.Read(buffer, sizeof(buffer), 0) == 0);
+}
+
+static void
+TestGetBuffer()
+{
+    const std::shared_ptr<ArAsset> parent = _MakeInMemoryAsset();
+    const std::shared_ptr<const char> parentBuffer = parent->GetBuffer();
+
+    std::shared_ptr<const char> buffer;
+    {
+        const ArSubrangeAsset asset(parent, 10, 6);
+        buffer = asset.GetBuffer();
+    }
+
+    // The returned buffer points into the parent's buffer and keeps it
+    // alive after the subrange asset is destroyed.
+    TF_AXIOM(buffer.get() == parentBuffer.get() + 10);
+    TF_AXIOM(std::string(buffer.get(), 6) == "abcdef");
+}
+
+static void
+TestGivenBuffer()
+{
+    const std::shared_ptr<ArAsset> parent = _MakeInMemoryAsset();
+
+    // A buffer given at construction is used by GetBuffer in place of the
+    // parent's, while reads still go to the parent. Use a buffer with
+    // different contents to tell the two apart.
+    std::shared_ptr<char> given(
+        new char[_contents.size()], std::default_delete<char[]>());
+    memset(given.get(), 'x', _contents.size());
+    const std::shared_ptr<const char> givenBuffer(given);
+
+    const std::shared_ptr<ArAsset> outer =
+        std::make_shared<ArSubrangeAsset>(parent, givenBuffer, 4, 20);
+    TF_AXIOM(outer->GetBuffer().get() == givenBuffer.get() + 4);
+    TF_AXIOM(_ReadAll(*outer) == _contents.substr(4, 20));
+
+    // Nested ranges keep using the given buffer.
+    const ArSubrangeAsset inner(outer, 6, 6);
+    TF_AXIOM(inner.GetParent() == parent);
+    TF_AXIOM(inner.GetBuffer().get() == givenBuffer.get() + 10);
+    TF_AXIOM(_ReadAll(inner) == "abcdef");
+}
+
+static void
+TestNestedRanges()
+{
+    const std::shared_ptr<ArAsset> parent = _MakeInMemoryAsset();
+
+    // Nested ranges refer directly to the outermost asset.
+    std::shared_ptr<ArAsset> asset = parent;
+    size_t expectedOffset = 0;
+    for (size_t i = 0; i < 5; ++i) {
+        const size_t offset = 2;
+        asset = std::make_shared<ArSubrangeAsset>(
+            asset, offset, asset->GetSize() - offset * 2);
+        expectedOffset += offset;
+
+        const ArSubrangeAsset* range =
+            dynamic_cast<const ArSubrangeAsset*>(asset.get());
+        TF_AXIOM(range);
+        TF_AXIOM(range->GetParent() == parent);
+        TF_AXIOM(range->GetOffset() == expectedOffset);
+        TF_AXIOM(_ReadAll(*range) == _contents.substr(
+            expectedOffset, _contents.size() - expectedOffset * 2));
+        TF_AXIOM(range->GetBuffer().get() ==
+                 parent->GetBuffer().get() + expectedOffset);
+    }
+}
+
+static void
+TestGetFileUnsafe()
+{
+    // An in-memory parent has no file.
+    {
+        const ArSubrangeAsset asset(_MakeInMemoryAsset(), 10, 6);
+        TF_AXIOM(asset.GetFileUnsafe().first == nullptr);
+    }
+
+    const std::string tmpDir = ArchMakeTmpSubdir(".", "TestSubrangeAsset");
+    const std::string filePath = tmpDir + "/file.txt";
+    {
+        FILE* f = ArchOpenFile(filePath.c_str(), "wb");
+        TF_AXIOM(f);
+        TF_AXIOM(fwrite(_contents.data(), 1, _contents.size(), f) ==
+                 _contents.size());
+        fclose(f);
+    }
+
+    FILE* f = ArchOpenFile(filePath.c_str(), "rb");
+    TF_AXIOM(f);
+    const std::shared_ptr<ArAsset> parent =
+        std::make_shared<ArFilesystemAsset>(f);
+    const std::shared_ptr<ArAsset> outer =
+        std::make_shared<ArSubrangeAsset>(parent, 4, 20);
+    const ArSubrangeAsset inner(outer, 6, 6);
+
+    TF_AXIOM(_ReadAll(inner) == "abcdef");
+    TF_AXIOM(std::string(inner.GetBuffer().get(), 6) == "abcdef");
+
+    const std::pair<FILE*, size_t> file = inner.GetFileUnsafe();
+    TF_AXIOM(file.first == f);
+    TF_AXIOM(file.second == 10);
+
+    char buffer[6];
+    TF_AXIOM(ArchPRead(file.first, buffer, sizeof(buffer), file.second) ==
+             sizeof(buffer));
+    TF_AXIOM(std::string(buffer, sizeof(buffer)) == "abcdef");
+
+    TfRmTree(tmpDir);
+}
+
+static void
+TestInvalidRange()
+{
+    const std::shared_ptr<ArAsset> parent = _MakeInMemoryAsset();
+
+    {
+        TfErrorMark mark;
+        const ArSubrangeAsset asset(parent, 30, 100);
+        TF_AXIOM(!mark.IsClean());
+        mark.Clear();
+
+        // The range is clamped to the end of the parent asset.
+        TF_AXIOM(asset.GetOffset() == 30);
+        TF_AXIOM(asset.GetSize() == 6);
+        TF_AXIOM(_ReadAll(asset) == "uvwxyz");
+    }
+
+    {
+        TfErrorMark mark;
+        const ArSubrangeAsset asset(nullptr, 0, 10);
+        TF_AXIOM(!mark.IsClean());
+        mark.Clear();
+
+        char buffer[10];
+        TF_AXIOM(asset.GetSize() == 0);
+        TF_AXIOM(asset.Read(buffer, sizeof(buffer), 0) == 0);
+        TF_AXIOM(!asset.GetBuffer());
+        TF_AXIOM(asset.GetFileUnsafe().first == nullptr);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "TestRead..." << std::endl;
+    TestRead();
+
+    std::cout << "TestGetBuffer..." << std::endl;
+    TestGetBuffer();
+
+    std::cout << "TestGivenBuffer..." << std::endl;
+    TestGivenBuffer();
+
+    std::cout << "TestNestedRanges..." << std::endl;
+    TestNestedRanges();
+
+    std::cout << "TestGetFileUnsafe..." << std::endl;
+    TestGetFileUnsafe();
+
+    std::cout << "TestInvalidRange..." << std::endl;
+    TestInvalidRange();
+
+    std::cout << "Passed!" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,134 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include <pxr/ar/threadLocalScopedCache.h>
+#include <pxr/tf/diagnostic.h>
+#include <pxr/vt/value.h>
+
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace pxr;
+
+struct _TestCache
+{
+    int value = 0;
+};
+
+using _TestScopedCache = ArThreadLocalScopedCache<_TestCache>;
+
+static void
+TestCacheScopes()
+{
+    _TestScopedCache cache;
+    TF_AXIOM(!cache.BorrowCurrentCache());
+    TF_AXIOM(!cache.GetCurrentCache());
+
+    VtValue outerData;
+    cache.BeginCacheScope(&outerData);
+    _TestCache* outerCache = cache.BorrowCurrentCache();
+    TF_AXIOM(outerCache);
+    TF_AXIOM(outerCache == cache.GetCurrentCache().get());
+
+    // Nested scopes share the enclosing scope's cache.
+    {
+        VtValue innerData;
+        cache.BeginCacheScope(&innerData);
+        TF_AXIOM(cache.BorrowCurrentCache() == outerCache);
+        cache.EndCacheScope(&innerData);
+    }
+
+    cache.EndCacheScope(&outerData);
+    TF_AXIOM(!cache.BorrowCurrentCache());
+
+    // Reopening a scope with the saved data restores the same cache.
+    cache.BeginCacheScope(&outerData);
+    TF_AXIOM(cache.BorrowCurrentCache() == outerCache);
+    cache.EndCacheScope(&outerData);
+}
+
+static void
+TestMultipleInstances()
+{
+    // Alternating between instances must not return the other instance's
+    // caches.
+    _TestScopedCache cache1, cache2;
+
+    VtValue data1;
+    cache1.BeginCacheScope(&data1);
+    TF_AXIOM(cache1.BorrowCurrentCache());
+    TF_AXIOM(!cache2.BorrowCurrentCache());
+
+    VtValue data2;
+    cache2.BeginCacheScope(&data2);
+    TF_AXIOM(cache2.BorrowCurrentCache());
+    TF_AXIOM(cache1.BorrowCurrentCache() != cache2.BorrowCurrentCache());
+
+    cache1.EndCacheScope(&data1);
+    TF_AXIOM(!cache1.BorrowCurrentCache());
+    TF_AXIOM(cache2.BorrowCurrentCache());
+
+    cache2.EndCacheScope(&data2);
+    TF_AXIOM(!cache2.BorrowCurrentCache());
+
+    // A new instance, possibly at the same address as a destroyed one,
+    // must not see the destroyed instance's caches.
+    for (size_t i = 0; i < 4; ++i) {
+        std::unique_ptr<_TestScopedCache> cache(new _TestScopedCache);
+        TF_AXIOM(!cache->BorrowCurrentCache());
+
+        VtValue data;
+        cache->BeginCacheScope(&data);
+        TF_AXIOM(cache->BorrowCurrentCache());
+    }
+}
+
+static void
+TestThreads()
+{
+    // Cache scopes are specific to the thread they were opened in.
+    _TestScopedCache cache;
+
+    VtValue data;
+    cache.BeginCacheScope(&data);
+    _TestCache* mainCache = cache.BorrowCurrentCache();
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; ++i) {
+        threads.emplace_back([&cache, mainCache]() {
+            TF_AXIOM(!cache.BorrowCurrentCache());
+
+            VtValue threadData;
+            cache.BeginCacheScope(&threadData);
+            _TestCache* threadCache = cache.BorrowCurrentCache();
+            TF_AXIOM(threadCache && threadCache != mainCache);
+            cache.EndCacheScope(&threadData);
+        });
+    }
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    TF_AXIOM(cache.BorrowCurrentCache() == mainCache);
+    cache.EndCacheScope(&data);
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "TestCacheScopes..." << std::endl;
+    TestCacheScopes();
+
+    std::cout << "TestMultipleInstances..." << std::endl;
+    TestMultipleInstances();
+
+    std::cout << "TestThreads..." << std::endl;
+    TestThreads();
+
+    std::cout << "Passed!" << std::endl;
+
+    return EXIT_SUCCESS;
+}
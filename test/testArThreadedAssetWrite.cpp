@@ -0,0 +1,198 @@
+// Copyright 2026 Jeremy Retailleau
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include <pxr/ar/asset.h>
+#include <pxr/ar/resolvedPath.h>
+#include <pxr/ar/resolver.h>
+#include <pxr/ar/writableAsset.h>
+#include <pxr/tf/diagnostic.h>
+#include <pxr/tf/fileUtils.h>
+#include <pxr/arch/fileSystem.h>
+#include <pxr/arch/systemInfo.h>
+
+using namespace pxr;
+
+// ArWritableAsset::Write is documented to support concurrent writes to
+// disjoint ranges of the same asset. Verify that this holds by having many
+// threads write interleaved pieces of their own regions of a single asset
+// at the same time.
+
+#include <algorithm>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+std::mutex threadSyncMutex;
+std::mutex errorMutex;
+std::vector<std::string> errors;
+
+// Byte expected at the given offset in the asset.
+static char
+_ExpectedByte(size_t offset)
+{
+    return static_cast<char>('a' + (offset * 7 + offset / 4096) % 26);
+}
+
+static void
+_WriteRegionInThread(
+    ArWritableAsset* asset, ArWriteRegion region, size_t pieceSize)
+{
+    std::vector<char> data(region.size);
+    for (size_t i = 0; i < region.size; ++i) {
+        data[i] = _ExpectedByte(region.offset + i);
+    }
+
+    // Acquire then release the thread sync mutex
+    threadSyncMutex.lock();
+    threadSyncMutex.unlock();
+
+    // Write the region in small pieces so that writes from different
+    // threads are interleaved as much as possible.
+    for (size_t i = 0; i < region.size; i += pieceSize) {
+        const size_t count = std::min(pieceSize, region.size - i);
+        if (asset->Write(data.data() + i, count, region.offset + i) != count) {
+            std::unique_lock<std::mutex> lock(errorMutex);
+            errors.push_back(
+                "Failed to write " + std::to_string(count) + " bytes at " +
+                std::to_string(region.offset + i));
+            return;
+        }
+    }
+}
+
+static void
+_VerifyAsset(const std::string& fullPath, size_t expectedSize)
+{
+    ArResolver& resolver = ArGetResolver();
+
+    std::shared_ptr<ArAsset> asset = resolver.OpenAsset(ArResolvedPath(fullPath));
+    if (!asset) {
+        std::cerr << "Failed to open asset for read: " << fullPath << std::endl;
+        TF_AXIOM(asset);
+    }
+
+    TF_AXIOM(asset->GetSize() == expectedSize);
+    std::shared_ptr<const char> data = asset->GetBuffer();
+    for (size_t i = 0; i < expectedSize; ++i) {
+        if (data.get()[i] != _ExpectedByte(i)) {
+            std::cerr << "Unexpected byte at offset " << i << std::endl;
+            TF_AXIOM(data.get()[i] == _ExpectedByte(i));
+        }
+    }
+}
+
+static void
+TestSplitWriteRegions()
+{
+    TF_AXIOM(ArSplitWriteRegions(0, 4).empty());
+
+    // Regions must cover the whole asset without overlapping, start on
+    // aligned offsets and never be empty.
+    const size_t sizes[] = { 1, 100, 4095, 4096, 4097, 1 << 20, 12345678 };
+    const size_t counts[] = { 0, 1, 3, 8, 64, 1000 };
+    const size_t alignments[] = { 0, 1, 512, 4096 };
+    for (size_t totalSize : sizes) {
+        for (size_t numRegions : counts) {
+            for (size_t alignment : alignments) {
+                const std::vector<ArWriteRegion> regions =
+                    ArSplitWriteRegions(totalSize, numRegions, alignment);
+                TF_AXIOM(!regions.empty());
+                TF_AXIOM(regions.size() <= std::max<size_t>(numRegions, 1));
+
+                size_t expectedOffset = 0;
+                for (const ArWriteRegion& region : regions) {
+                    TF_AXIOM(region.offset == expectedOffset);
+                    TF_AXIOM(region.size > 0);
+                    if (alignment > 1) {
+                        TF_AXIOM(region.offset % alignment == 0);
+                    }
+                    expectedOffset += region.size;
+                }
+                TF_AXIOM(expectedOffset == totalSize);
+            }
+        }
+    }
+}
+
+static void
+TestThreadedAssetWrite(ArResolver::WriteMode writeMode)
+{
+    const std::string tmpDir = ArchMakeTmpSubdir(".", "TestWriteAsset");
+    const std::string fullPath = tmpDir + "/Asset.out";
+
+    const size_t numThreads = 16;
+    const size_t totalSize = 4 * 1024 * 1024 + 123;
+
+    for (size_t iteration = 0; iteration < 4; ++iteration) {
+        std::shared_ptr<ArWritableAsset> asset =
+            ArGetResolver().OpenAssetForWrite(
+                ArResolvedPath(fullPath), writeMode);
+        TF_AXIOM(asset);
+
+        // Vary the alignment and piece size between iterations, including
+        // unaligned regions that share filesystem blocks.
+        const size_t alignment = (iteration % 2) ? 4096 : 1;
+        const size_t pieceSize = 97 + iteration * 1000;
+
+        asset->Reserve(totalSize);
+        const std::vector<ArWriteRegion> regions =
+            ArSplitWriteRegions(totalSize, numThreads, alignment);
+
+        // Acquire threadSyncMutex to keep the threads from running off
+        // without us.
+        threadSyncMutex.lock();
+
+        std::vector<std::thread> threads;
+        for (const ArWriteRegion& region : regions) {
+            threads.emplace_back(
+                _WriteRegionInThread, asset.get(), region, pieceSize);
+        }
+
+        // And release them.
+        threadSyncMutex.unlock();
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        // Report any errors.
+        for (const std::string& error : errors) {
+            std::cerr << error << std::endl;
+        }
+
+        // Fail if errors was not empty
+        TF_AXIOM(errors.empty());
+
+        TF_AXIOM(asset->Close());
+        asset.reset();
+
+        // Make sure we can read the data back.
+        _VerifyAsset(fullPath, totalSize);
+    }
+
+    // Cleanup
+    TfRmTree(tmpDir);
+}
+
+int main(int argc, char** argv)
+{
+    // Set the preferred resolver to ArDefaultResolver.
+    ArSetPreferredResolver("ArDefaultResolver");
+
+    std::cout << "TestSplitWriteRegions..." << std::endl;
+    TestSplitWriteRegions();
+
+    std::cout << "TestThreadedAssetWrite (Replace)..." << std::endl;
+    TestThreadedAssetWrite(ArResolver::WriteMode::Replace);
+
+    std::cout << "TestThreadedAssetWrite (Update)..." << std::endl;
+    TestThreadedAssetWrite(ArResolver::WriteMode::Update);
+
+    std::cout << "Passed!" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -7,22 +7,28 @@
 
 #include "plugin.h"
 
+#include <pxr/ar/asset.h>
 #include <pxr/ar/defaultResolverContext.h>
 #include <pxr/ar/defineResolverContext.h>
 #include <pxr/ar/resolver.h>
 #include <pxr/ar/resolverContext.h>
 #include <pxr/ar/resolverContextBinder.h>
+#include <pxr/ar/writableAsset.h>
 
+#include <pxr/arch/fileSystem.h>
 #include <pxr/arch/systemInfo.h>
 #include <pxr/plug/plugin.h>
 #include <pxr/plug/registry.h>
 #include <pxr/tf/diagnosticMgr.h>
+#include <pxr/tf/errorMark.h>
+#include <pxr/tf/fileUtils.h>
 #include <pxr/tf/pathUtils.h>
 #include <pxr/tf/setenv.h>
 #include <pxr/tf/getenv.h>
 #include <pxr/tf/status.h>
 #include <pxr/tf/stringUtils.h>
 #include <pxr/tf/token.h>
+#include <pxr/vt/value.h>
 
 using namespace pxr;
 
@@ -75,6 +81,42 @@ TestResolveWithContext()
         TF_AXIOM(resolver.Resolve("test://foo") == "test://foo");
     }
     TF_AXIOM(resolver.Resolve("test://foo") == "test://foo?context");
+
+    // Verify that unbinding contexts out of order leaves the most
+    // recently-bound context in place.
+    {
+        ArResolverContext ctx4(_TestURIResolverContext("context4"));
+        ArResolverContext ctx5(_TestURIResolverContext("context5"));
+        VtValue bindingData4, bindingData5;
+        resolver.BindContext(ctx4, &bindingData4);
+        resolver.BindContext(ctx5, &bindingData5);
+        TF_AXIOM(resolver.Resolve("test://foo") == "test://foo?context5");
+
+        resolver.UnbindContext(ctx4, &bindingData4);
+        TF_AXIOM(resolver.Resolve("test://foo") == "test://foo?context5");
+        TF_AXIOM(resolver.GetCurrentContext().Get<_TestURIResolverContext>()
+                 ->data == "context5");
+
+        resolver.UnbindContext(ctx5, &bindingData5);
+    }
+    TF_AXIOM(resolver.Resolve("test://foo") == "test://foo?context");
+
+    // Verify that the bound context doesn't need to outlive the call to
+    // BindContext.
+    {
+        VtValue bindingData;
+        resolver.BindContext(
+            ArResolverContext(_TestURIResolverContext("context6")),
+            &bindingData);
+        TF_AXIOM(resolver.Resolve("test://foo") == "test://foo?context6");
+        TF_AXIOM(resolver.GetCurrentContext().Get<_TestURIResolverContext>()
+                 ->data == "context6");
+
+        resolver.UnbindContext(
+            ArResolverContext(_TestURIResolverContext("context6")),
+            &bindingData);
+    }
+    TF_AXIOM(resolver.Resolve("test://foo") == "test://foo?context");
 }
 
 static void
@@ -193,6 +235,80 @@ TestCreateDefaultContextForAsset()
     runTest("test/test.file[in_package]");
 }
 
+static void
+_WriteAsset(const std::string& path, const std::string& contents)
+{
+    std::shared_ptr<ArWritableAsset> asset =
+        ArGetResolver().OpenAssetForWrite(
+            ArResolvedPath(path), ArResolver::WriteMode::Replace);
+    TF_AXIOM(asset);
+    TF_AXIOM(asset->Write(contents.c_str(), contents.size(), 0) ==
+        contents.size());
+    TF_AXIOM(asset->Close());
+}
+
+static std::string
+_ReadAsset(const std::string& path)
+{
+    std::shared_ptr<ArAsset> asset =
+        ArGetResolver().OpenAsset(ArResolvedPath(path));
+    TF_AXIOM(asset);
+
+    std::shared_ptr<const char> buffer = asset->GetBuffer();
+    TF_AXIOM(buffer);
+    return std::string(buffer.get(), asset->GetSize());
+}
+
+static void
+TestCopyAsset()
+{
+    const std::string tmpDir =
+        ArchMakeTmpSubdir(ArchGetCwd(), "testArURIResolver_CPP_Copy");
+    TF_AXIOM(!tmpDir.empty());
+
+    // Use contents larger than the 8 MiB buffer ArResolver uses when
+    // streaming a copy so the copy takes multiple iterations.
+    std::string contents;
+    for (size_t i = 0; contents.size() < 9 * 1024 * 1024; ++i) {
+        contents += TfStringPrintf("line %zu\n", i);
+    }
+
+    const std::string srcPath = tmpDir + "/src.txt";
+    _WriteAsset(srcPath, contents);
+
+    // Copying between assets handled by different resolvers streams the
+    // contents through the resolvers for each asset.
+    TF_AXIOM(ArGetResolver().CopyAsset(
+        ArResolvedPath(srcPath), ArResolvedPath("test://copy"),
+        ArResolver::WriteMode::Replace));
+    TF_AXIOM(_ReadAsset("test://copy") == contents);
+
+    const std::string dstPath = tmpDir + "/dst.txt";
+    TF_AXIOM(ArGetResolver().CopyAsset(
+        ArResolvedPath("test://copy"), ArResolvedPath(dstPath),
+        ArResolver::WriteMode::Replace));
+    TF_AXIOM(_ReadAsset(dstPath) == contents);
+
+    TF_AXIOM(ArGetResolver().CopyAsset(
+        ArResolvedPath("test://copy"), ArResolvedPath("test-other://copy"),
+        ArResolver::WriteMode::Replace));
+    TF_AXIOM(_ReadAsset("test-other://copy") == contents);
+
+    // Copying an asset the source resolver can't open fails without
+    // touching the destination.
+    {
+        TfErrorMark m;
+        TF_AXIOM(!ArGetResolver().CopyAsset(
+            ArResolvedPath("test://bogus"), ArResolvedPath(dstPath),
+            ArResolver::WriteMode::Replace));
+        TF_AXIOM(!m.IsClean());
+        m.Clear();
+    }
+    TF_AXIOM(_ReadAsset(dstPath) == contents);
+
+    TfRmTree(tmpDir);
+}
+
 int main(int argc, char** argv)
 {
     SetupPlugins();
@@ -209,6 +325,9 @@ int main(int argc, char** argv)
     printf("TestCreateDefaultContextForAsset ...\n");
     TestCreateDefaultContextForAsset();
 
+    printf("TestCopyAsset ...\n");
+    TestCopyAsset();
+
     printf("Test PASSED\n");
     return 0;
 }
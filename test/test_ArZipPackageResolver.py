@@ -0,0 +1,150 @@
+# Copyright 2026 Jeremy Retailleau
+#
+# Licensed under the terms set forth in the LICENSE.txt file available at
+# https://openusd.org/license.
+
+import os
+import tempfile
+import unittest
+import zipfile
+
+from pxr import Ar, Tf
+
+# Whether Ar was built with the ENABLE_ZLIB option, which is required to
+# read deflated members of zip archives.
+_zlibEnabled = os.environ.get('AR_ENABLE_ZLIB') == '1'
+
+class TestArZipPackageResolver(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        Ar.SetPreferredResolver('ArDefaultResolver')
+
+    def setUp(self):
+        # Create a temporary directory containing a zip archive with a mix
+        # of stored and deflated members, along with an archive nested in
+        # another archive.
+        self._tempDir = tempfile.TemporaryDirectory()
+        self._archivePath = os.path.join(self._tempDir.name, 'test.zip')
+        self._nestedArchivePath = os.path.join(self._tempDir.name, 'outer.zip')
+
+        self._storedData = b'stored contents\n'
+        self._deflatedData = b'deflated contents\n' * 1000
+
+        with zipfile.ZipFile(self._archivePath, 'w') as archive:
+            archive.writestr(zipfile.ZipInfo('dir/'), b'')
+            archive.writestr('dir/stored.txt', self._storedData,
+                             compress_type=zipfile.ZIP_STORED)
+            archive.writestr('deflated.txt', self._deflatedData,
+                             compress_type=zipfile.ZIP_DEFLATED)
+            archive.writestr('empty.txt', b'',
+                             compress_type=zipfile.ZIP_STORED)
+
+        with zipfile.ZipFile(self._nestedArchivePath, 'w') as archive:
+            archive.write(self._archivePath, 'inner.zip',
+                          compress_type=zipfile.ZIP_STORED)
+
+    def tearDown(self):
+        self._tempDir.cleanup()
+
+    def _readAsset(self, path):
+        asset = Ar.GetResolver().OpenAsset(Ar.ResolvedPath(path))
+        self.assertTrue(asset, 'Expected asset to be valid: ' + path)
+        with asset:
+            return asset.Read(asset.GetSize(), 0)
+
+    def test_Resolve(self):
+        resolver = Ar.GetResolver()
+
+        path = Ar.JoinPackageRelativePath(self._archivePath, 'dir/stored.txt')
+        self.assertEqual(resolver.Resolve(path), path)
+
+        path = Ar.JoinPackageRelativePath(self._archivePath, 'deflated.txt')
+        self.assertEqual(resolver.Resolve(path), path)
+
+        # Missing members and directory entries do not resolve.
+        self.assertEqual(resolver.Resolve(
+            Ar.JoinPackageRelativePath(self._archivePath, 'missing.txt')), '')
+        self.assertEqual(resolver.Resolve(
+            Ar.JoinPackageRelativePath(self._archivePath, 'dir/')), '')
+
+    def test_ResolveNested(self):
+        path = Ar.JoinPackageRelativePath(
+            [self._nestedArchivePath, 'inner.zip', 'dir/stored.txt'])
+        self.assertEqual(Ar.GetResolver().Resolve(path), path)
+
+        self.assertEqual(Ar.GetResolver().Resolve(
+            Ar.JoinPackageRelativePath(
+                [self._nestedArchivePath, 'inner.zip', 'missing.txt'])), '')
+
+    def test_OpenStoredAsset(self):
+        path = Ar.JoinPackageRelativePath(self._archivePath, 'dir/stored.txt')
+        self.assertEqual(self._readAsset(path), self._storedData)
+
+        path = Ar.JoinPackageRelativePath(
+            [self._nestedArchivePath, 'inner.zip', 'dir/stored.txt'])
+        self.assertEqual(self._readAsset(path), self._storedData)
+
+    def test_OpenStoredAssetPartialRead(self):
+        path = Ar.JoinPackageRelativePath(self._archivePath, 'dir/stored.txt')
+        with Ar.GetResolver().OpenAsset(Ar.ResolvedPath(path)) as asset:
+            self.assertEqual(asset.GetSize(), len(self._storedData))
+            self.assertEqual(asset.Read(8, 7), self._storedData[7:15])
+            self.assertEqual(asset.Read(999999, 7), self._storedData[7:])
+
+    def test_OpenEmptyAsset(self):
+        path = Ar.JoinPackageRelativePath(self._archivePath, 'empty.txt')
+        with Ar.GetResolver().OpenAsset(Ar.ResolvedPath(path)) as asset:
+            self.assertTrue(asset)
+            self.assertEqual(asset.GetSize(), 0)
+
+    @unittest.skipUnless(_zlibEnabled, 'Ar was built without zlib')
+    def test_OpenDeflatedAsset(self):
+        path = Ar.JoinPackageRelativePath(self._archivePath, 'deflated.txt')
+        with Ar.GetResolver().OpenAsset(Ar.ResolvedPath(path)) as asset:
+            self.assertEqual(asset.GetSize(), len(self._deflatedData))
+            self.assertEqual(
+                asset.Read(asset.GetSize(), 0), self._deflatedData)
+
+    @unittest.skipIf(_zlibEnabled, 'Ar was built with zlib')
+    def test_OpenDeflatedAssetWithoutZlib(self):
+        # Deflated members are still resolved, but opening them is an error.
+        path = Ar.JoinPackageRelativePath(self._archivePath, 'deflated.txt')
+        self.assertEqual(Ar.GetResolver().Resolve(path), path)
+        with self.assertRaises(Tf.ErrorException):
+            Ar.GetResolver().OpenAsset(Ar.ResolvedPath(path))
+
+    def test_OpenMissingAsset(self):
+        path = Ar.JoinPackageRelativePath(self._archivePath, 'missing.txt')
+        self.assertIsNone(
+            Ar.GetResolver().OpenAsset(Ar.ResolvedPath(path)))
+
+    def test_ArchiveModified(self):
+        path = Ar.JoinPackageRelativePath(self._archivePath, 'new.txt')
+        self.assertEqual(Ar.GetResolver().Resolve(path), '')
+
+        # Rewrite the archive with a new member and make sure the change in
+        # modification time causes the archive to be indexed again.
+        with zipfile.ZipFile(self._archivePath, 'a') as archive:
+            archive.writestr('new.txt', b'new contents',
+                             compress_type=zipfile.ZIP_STORED)
+        stat = os.stat(self._archivePath)
+        os.utime(self._archivePath, (stat.st_atime, stat.st_mtime + 10))
+
+        self.assertEqual(Ar.GetResolver().Resolve(path), path)
+        self.assertEqual(self._readAsset(path), b'new contents')
+
+    def test_InvalidArchive(self):
+        invalidPath = os.path.join(self._tempDir.name, 'invalid.zip')
+        with open(invalidPath, 'wb') as f:
+            f.write(b'not a zip archive')
+
+        # Failing to read the archive's central directory is reported as an
+        # error.
+        with self.assertRaises(Tf.ErrorException):
+            Ar.GetResolver().Resolve(
+                Ar.JoinPackageRelativePath(invalidPath, 'file.txt'))
+
+
+if __name__ == '__main__':
+    unittest.main()